@@ -4457,10 +4457,33 @@ struct engine_configuration_s {
 	 */
 	uint8_t simulatorCamPosition[CAM_INPUTS_COUNT];
 	/**
-	units
+	 * Resonance frequencies for multi-band software knock, zero disables a band. When any band is set, knock energy is measured at each of these frequencies instead of the single knockBandCustom bandpass.
+	kHz
 	 * offset 4314
 	 */
-	uint8_t mainUnusedEnd[242];
+	scaled_channel<uint8_t, 10, 1> knockSpectrumBands[KNOCK_SPECTRUM_BANDS];
+	/**
+	 * Maximum number of Lua VM instructions, in thousands, a single onTick or CAN RX callback may run before it is aborted. Zero means no limit.
+	k instr
+	 * offset 4318
+	 */
+	uint16_t luaHookBudget;
+	/**
+	 * Slow SD log fields (temperatures, voltages, counters) are only written with every Nth record, RPM, MAP, lambda, timing and knock are written with every record. 1 writes every field every time, which is the only option MegaLogViewer can read directly.
+	records
+	 * offset 4320
+	 */
+	uint8_t sdCardLogSlowDivider;
+	/**
+	 * Trigger mode SD log encoding. 'Compact' stores tooth period deltas and flag changes, usually 2 bytes per event instead of 5, but needs a rusEFI tool to read.
+	 * offset 4321
+	 */
+	ToothLogFormat sdTriggerLogFormat;
+	/**
+	units
+	 * offset 4322
+	 */
+	uint8_t mainUnusedEnd[234];
 };
 static_assert(sizeof(engine_configuration_s) == 4556);
 
@@ -152,6 +152,21 @@
 #define EFI_SIGNAL_EXECUTOR_ONE_TIMER TRUE
 #define EFI_SIGNAL_EXECUTOR_HW_TIMER FALSE
 
+/**
+ * Pairing heap instead of sorted linked list for pending events, useful with
+ * many cylinders/multi-spark where dozens of events are pending at once
+ */
+#ifndef EFI_EVENT_QUEUE_HEAP
+#define EFI_EVENT_QUEUE_HEAP FALSE
+#endif
+
+/**
+ * Default for RpmCalculator::predictiveAngleScheduling, 'enable predictive_angle_scheduling' in console
+ */
+#ifndef EFI_PREDICTIVE_ANGLE_SCHEDULING
+#define EFI_PREDICTIVE_ANGLE_SCHEDULING FALSE
+#endif
+
 #define FUEL_MATH_EXTREME_LOGGING FALSE
 
 #define SPARK_EXTREME_LOGGING FALSE
@@ -335,6 +350,11 @@
 #define EFI_LUA_LOOKUP TRUE
 #endif
 
+// keep compiled script around for faster Lua restarts, costs LUA_BYTECODE_CACHE_SIZE of RAM
+#ifndef EFI_LUA_BYTECODE_CACHE
+#define EFI_LUA_BYTECODE_CACHE FALSE
+#endif
+
 #ifndef EFI_ENGINE_SNIFFER
 #define EFI_ENGINE_SNIFFER TRUE
 #endif
@@ -453,6 +473,11 @@
 #define EFI_STORAGE_INT_FLASH   TRUE
 #endif
 
+// append changed regions after the image instead of erasing on every burn, see flash_journal.h
+#ifndef EFI_STORAGE_INT_FLASH_JOURNAL
+#define EFI_STORAGE_INT_FLASH_JOURNAL TRUE
+#endif
+
 #ifndef EFI_STORAGE_EXT_SNOR
 #define EFI_STORAGE_EXT_SNOR    FALSE
 #endif
@@ -31,6 +31,10 @@
 #define EFI_CONSOLE_RX_BRAIN_PIN Gpio::D9
 #endif
 
+#ifndef EFI_LUA_BYTECODE_CACHE
+#define EFI_LUA_BYTECODE_CACHE TRUE
+#endif
+
 // note order of include - first we set F7 defaults (above) and only later we apply F4 defaults
 #include "../stm32f4ems/efifeatures.h"
 
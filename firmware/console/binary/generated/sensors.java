@@ -264,126 +264,108 @@ engineRunTime("engineRunTime", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 67
 distanceTraveled("distanceTraveled", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 678, 0.1, 0.0, 0.0, "km"),
 afrGasolineScale("Air/Fuel Ratio (Gas Scale)", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 680, 0.001, 0.0, 0.0, "AFR"),
 afr2GasolineScale("Air/Fuel Ratio 2 (Gas Scale)", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 682, 0.001, 0.0, 0.0, "AFR"),
-unusedAtTheEnd1("unusedAtTheEnd 1", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 684, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd2("unusedAtTheEnd 2", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 685, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd3("unusedAtTheEnd 3", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 686, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd4("unusedAtTheEnd 4", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 687, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd5("unusedAtTheEnd 5", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 688, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd6("unusedAtTheEnd 6", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 689, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd7("unusedAtTheEnd 7", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 690, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd8("unusedAtTheEnd 8", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 691, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd9("unusedAtTheEnd 9", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 692, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd10("unusedAtTheEnd 10", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 693, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd11("unusedAtTheEnd 11", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 694, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd12("unusedAtTheEnd 12", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 695, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd13("unusedAtTheEnd 13", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 696, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd14("unusedAtTheEnd 14", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 697, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd15("unusedAtTheEnd 15", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 698, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd16("unusedAtTheEnd 16", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 699, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd17("unusedAtTheEnd 17", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 700, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd18("unusedAtTheEnd 18", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 701, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd19("unusedAtTheEnd 19", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 702, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd20("unusedAtTheEnd 20", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 703, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd21("unusedAtTheEnd 21", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 704, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd22("unusedAtTheEnd 22", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 705, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd23("unusedAtTheEnd 23", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 706, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd24("unusedAtTheEnd 24", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 707, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd25("unusedAtTheEnd 25", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 708, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd26("unusedAtTheEnd 26", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 709, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd27("unusedAtTheEnd 27", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 710, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd28("unusedAtTheEnd 28", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 711, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd29("unusedAtTheEnd 29", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 712, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd30("unusedAtTheEnd 30", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 713, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd31("unusedAtTheEnd 31", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 714, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd32("unusedAtTheEnd 32", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 715, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd33("unusedAtTheEnd 33", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 716, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd34("unusedAtTheEnd 34", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 717, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd35("unusedAtTheEnd 35", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 718, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd36("unusedAtTheEnd 36", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 719, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd37("unusedAtTheEnd 37", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 720, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd38("unusedAtTheEnd 38", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 721, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd39("unusedAtTheEnd 39", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 722, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd40("unusedAtTheEnd 40", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 723, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd41("unusedAtTheEnd 41", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 724, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd42("unusedAtTheEnd 42", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 725, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd43("unusedAtTheEnd 43", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 726, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd44("unusedAtTheEnd 44", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 727, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd45("unusedAtTheEnd 45", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 728, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd46("unusedAtTheEnd 46", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 729, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd47("unusedAtTheEnd 47", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 730, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd48("unusedAtTheEnd 48", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 731, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd49("unusedAtTheEnd 49", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 732, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd50("unusedAtTheEnd 50", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 733, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd51("unusedAtTheEnd 51", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 734, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd52("unusedAtTheEnd 52", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 735, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd53("unusedAtTheEnd 53", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 736, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd54("unusedAtTheEnd 54", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 737, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd55("unusedAtTheEnd 55", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 738, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd56("unusedAtTheEnd 56", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 739, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd57("unusedAtTheEnd 57", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 740, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd58("unusedAtTheEnd 58", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 741, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd59("unusedAtTheEnd 59", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 742, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd60("unusedAtTheEnd 60", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 743, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd61("unusedAtTheEnd 61", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 744, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd62("unusedAtTheEnd 62", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 745, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd63("unusedAtTheEnd 63", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 746, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd64("unusedAtTheEnd 64", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 747, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd65("unusedAtTheEnd 65", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 748, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd66("unusedAtTheEnd 66", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 749, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd67("unusedAtTheEnd 67", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 750, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd68("unusedAtTheEnd 68", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 751, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd69("unusedAtTheEnd 69", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 752, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd70("unusedAtTheEnd 70", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 753, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd71("unusedAtTheEnd 71", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 754, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd72("unusedAtTheEnd 72", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 755, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd73("unusedAtTheEnd 73", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 756, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd74("unusedAtTheEnd 74", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 757, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd75("unusedAtTheEnd 75", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 758, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd76("unusedAtTheEnd 76", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 759, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd77("unusedAtTheEnd 77", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 760, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd78("unusedAtTheEnd 78", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 761, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd79("unusedAtTheEnd 79", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 762, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd80("unusedAtTheEnd 80", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 763, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd81("unusedAtTheEnd 81", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 764, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd82("unusedAtTheEnd 82", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 765, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd83("unusedAtTheEnd 83", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 766, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd84("unusedAtTheEnd 84", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 767, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd85("unusedAtTheEnd 85", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 768, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd86("unusedAtTheEnd 86", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 769, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd87("unusedAtTheEnd 87", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 770, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd88("unusedAtTheEnd 88", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 771, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd89("unusedAtTheEnd 89", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 772, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd90("unusedAtTheEnd 90", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 773, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd91("unusedAtTheEnd 91", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 774, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd92("unusedAtTheEnd 92", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 775, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd93("unusedAtTheEnd 93", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 776, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd94("unusedAtTheEnd 94", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 777, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd95("unusedAtTheEnd 95", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 778, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd96("unusedAtTheEnd 96", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 779, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd97("unusedAtTheEnd 97", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 780, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd98("unusedAtTheEnd 98", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 781, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd99("unusedAtTheEnd 99", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 782, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd100("unusedAtTheEnd 100", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 783, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd101("unusedAtTheEnd 101", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 784, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd102("unusedAtTheEnd 102", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 785, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd103("unusedAtTheEnd 103", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 786, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd104("unusedAtTheEnd 104", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 787, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd105("unusedAtTheEnd 105", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 788, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd106("unusedAtTheEnd 106", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 789, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd107("unusedAtTheEnd 107", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 790, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd108("unusedAtTheEnd 108", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 791, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd109("unusedAtTheEnd 109", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 792, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd110("unusedAtTheEnd 110", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 793, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd111("unusedAtTheEnd 111", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 794, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd112("unusedAtTheEnd 112", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 795, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd113("unusedAtTheEnd 113", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 796, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd114("unusedAtTheEnd 114", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 797, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd115("unusedAtTheEnd 115", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 798, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd116("unusedAtTheEnd 116", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 799, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd117("unusedAtTheEnd 117", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 800, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd118("unusedAtTheEnd 118", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 801, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd119("unusedAtTheEnd 119", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 802, 1.0, 0.0, 0.0, ""),
-unusedAtTheEnd120("unusedAtTheEnd 120", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 803, 1.0, 0.0, 0.0, ""),
+luaTickMinUs("Lua: onTick min duration", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 684, 1.0, 0.0, 0.0, "us"),
+luaTickAvgUs("Lua: onTick avg duration", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 686, 1.0, 0.0, 0.0, "us"),
+luaTickMaxUs("Lua: onTick max duration", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 688, 1.0, 0.0, 0.0, "us"),
+luaCanRxMinUs("Lua: onCanRx min duration", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 690, 1.0, 0.0, 0.0, "us"),
+luaCanRxAvgUs("Lua: onCanRx avg duration", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 692, 1.0, 0.0, 0.0, "us"),
+luaCanRxMaxUs("Lua: onCanRx max duration", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 694, 1.0, 0.0, 0.0, "us"),
+luaCanCallbackMinUs("Lua: CAN callback min duration", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 696, 1.0, 0.0, 0.0, "us"),
+luaCanCallbackAvgUs("Lua: CAN callback avg duration", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 698, 1.0, 0.0, 0.0, "us"),
+luaCanCallbackMaxUs("Lua: CAN callback max duration", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 700, 1.0, 0.0, 0.0, "us"),
+luaHookBudgetAborts("Lua: hooks aborted over budget", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 702, 1.0, 0.0, 0.0, "count"),
+luaLoadDuration("Lua: script load duration", SensorCategory.SENSOR_INPUTS, FieldType.INT, 704, 1.0, 0.0, 0.0, "us"),
+luaBytecodeCacheHits("Lua: loads from bytecode cache", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 708, 1.0, 0.0, 0.0, "count"),
+sdLogDroppedRecords("SD log: dropped records", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 710, 1.0, 0.0, 0.0, "count"),
+sdLogMaxWriteLatency("SD log: max write latency", SensorCategory.SENSOR_INPUTS, FieldType.INT, 712, 1.0, 0.0, 0.0, "us"),
+unusedAtTheEnd1("unusedAtTheEnd 1", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 716, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd2("unusedAtTheEnd 2", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 717, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd3("unusedAtTheEnd 3", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 718, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd4("unusedAtTheEnd 4", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 719, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd5("unusedAtTheEnd 5", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 720, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd6("unusedAtTheEnd 6", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 721, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd7("unusedAtTheEnd 7", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 722, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd8("unusedAtTheEnd 8", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 723, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd9("unusedAtTheEnd 9", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 724, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd10("unusedAtTheEnd 10", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 725, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd11("unusedAtTheEnd 11", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 726, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd12("unusedAtTheEnd 12", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 727, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd13("unusedAtTheEnd 13", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 728, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd14("unusedAtTheEnd 14", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 729, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd15("unusedAtTheEnd 15", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 730, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd16("unusedAtTheEnd 16", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 731, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd17("unusedAtTheEnd 17", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 732, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd18("unusedAtTheEnd 18", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 733, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd19("unusedAtTheEnd 19", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 734, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd20("unusedAtTheEnd 20", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 735, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd21("unusedAtTheEnd 21", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 736, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd22("unusedAtTheEnd 22", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 737, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd23("unusedAtTheEnd 23", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 738, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd24("unusedAtTheEnd 24", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 739, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd25("unusedAtTheEnd 25", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 740, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd26("unusedAtTheEnd 26", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 741, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd27("unusedAtTheEnd 27", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 742, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd28("unusedAtTheEnd 28", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 743, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd29("unusedAtTheEnd 29", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 744, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd30("unusedAtTheEnd 30", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 745, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd31("unusedAtTheEnd 31", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 746, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd32("unusedAtTheEnd 32", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 747, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd33("unusedAtTheEnd 33", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 748, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd34("unusedAtTheEnd 34", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 749, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd35("unusedAtTheEnd 35", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 750, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd36("unusedAtTheEnd 36", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 751, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd37("unusedAtTheEnd 37", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 752, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd38("unusedAtTheEnd 38", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 753, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd39("unusedAtTheEnd 39", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 754, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd40("unusedAtTheEnd 40", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 755, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd41("unusedAtTheEnd 41", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 756, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd42("unusedAtTheEnd 42", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 757, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd43("unusedAtTheEnd 43", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 758, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd44("unusedAtTheEnd 44", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 759, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd45("unusedAtTheEnd 45", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 760, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd46("unusedAtTheEnd 46", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 761, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd47("unusedAtTheEnd 47", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 762, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd48("unusedAtTheEnd 48", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 763, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd49("unusedAtTheEnd 49", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 764, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd50("unusedAtTheEnd 50", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 765, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd51("unusedAtTheEnd 51", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 766, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd52("unusedAtTheEnd 52", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 767, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd53("unusedAtTheEnd 53", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 768, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd54("unusedAtTheEnd 54", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 769, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd55("unusedAtTheEnd 55", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 770, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd56("unusedAtTheEnd 56", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 771, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd57("unusedAtTheEnd 57", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 772, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd58("unusedAtTheEnd 58", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 773, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd59("unusedAtTheEnd 59", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 774, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd60("unusedAtTheEnd 60", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 775, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd61("unusedAtTheEnd 61", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 776, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd62("unusedAtTheEnd 62", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 777, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd63("unusedAtTheEnd 63", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 778, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd64("unusedAtTheEnd 64", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 779, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd65("unusedAtTheEnd 65", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 780, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd66("unusedAtTheEnd 66", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 781, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd67("unusedAtTheEnd 67", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 782, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd68("unusedAtTheEnd 68", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 783, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd69("unusedAtTheEnd 69", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 784, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd70("unusedAtTheEnd 70", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 785, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd71("unusedAtTheEnd 71", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 786, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd72("unusedAtTheEnd 72", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 787, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd73("unusedAtTheEnd 73", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 788, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd74("unusedAtTheEnd 74", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 789, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd75("unusedAtTheEnd 75", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 790, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd76("unusedAtTheEnd 76", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 791, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd77("unusedAtTheEnd 77", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 792, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd78("unusedAtTheEnd 78", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 793, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd79("unusedAtTheEnd 79", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 794, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd80("unusedAtTheEnd 80", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 795, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd81("unusedAtTheEnd 81", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 796, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd82("unusedAtTheEnd 82", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 797, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd83("unusedAtTheEnd 83", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 798, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd84("unusedAtTheEnd 84", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 799, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd85("unusedAtTheEnd 85", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 800, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd86("unusedAtTheEnd 86", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 801, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd87("unusedAtTheEnd 87", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 802, 1.0, 0.0, 0.0, ""),
+unusedAtTheEnd88("unusedAtTheEnd 88", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 803, 1.0, 0.0, 0.0, ""),
 totalFuelCorrection("Fuel: Total correction", SensorCategory.SENSOR_INPUTS, FieldType.INT, 804, 1.0, 0.0, 3.0, "mult"),
 running("running", SensorCategory.SENSOR_INPUTS, FieldType.INT, 808, 1.0, -1.0, -1.0, ""),
 afrTableYAxis("afrTableYAxis", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 828, 0.01, 0.0, 0.0, "%"),
@@ -422,140 +404,145 @@ m_knockRetard("Knock: Retard", SensorCategory.SENSOR_INPUTS, FieldType.INT, 908,
 m_knockThreshold("Knock: Threshold", SensorCategory.SENSOR_INPUTS, FieldType.INT, 912, 1.0, -1.0, -1.0, ""),
 m_knockCount("Knock: Count", SensorCategory.SENSOR_INPUTS, FieldType.INT, 916, 1.0, 0.0, 0.0, ""),
 m_maximumRetard("Knock: Max retard", SensorCategory.SENSOR_INPUTS, FieldType.INT, 920, 1.0, -1.0, -1.0, ""),
-throttleModelCrossoverAngle("Air: Throttle crossover pos", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 928, 0.01, 0.0, 100.0, "%"),
-alignmentFill_at_6("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 930, 1.0, -20.0, 100.0, "units"),
-throttleEstimatedFlow("Air: Throttle flow estimate", SensorCategory.SENSOR_INPUTS, FieldType.INT, 932, 1.0, 0.0, 5.0, "g/s"),
-m_requested_pump("GDI: HPFP duration\nComputed requested pump duration in degrees (not including deadtime)", SensorCategory.SENSOR_INPUTS, FieldType.INT, 936, 1.0, -1.0, -1.0, ""),
-fuel_requested_percent("GDI: requested_percent", SensorCategory.SENSOR_INPUTS, FieldType.INT, 940, 1.0, -1.0, -1.0, ""),
-fuel_requested_percent_pi("GDI: percent_pi", SensorCategory.SENSOR_INPUTS, FieldType.INT, 944, 1.0, -1.0, -1.0, ""),
-m_pressureTarget_kPa("GDI: target pressure", SensorCategory.SENSOR_INPUTS, FieldType.INT, 952, 1.0, -1.0, -1.0, ""),
-nextLobe("GDI: nextLobe", SensorCategory.SENSOR_INPUTS, FieldType.INT, 956, 1.0, -1.0, -1.0, ""),
-di_nextStart("GDI: next start", SensorCategory.SENSOR_INPUTS, FieldType.INT, 960, 1.0, 0.0, 100.0, "v"),
-m_deadtime("Fuel: injector lag", SensorCategory.SENSOR_INPUTS, FieldType.INT, 964, 1.0, 0.0, 0.0, "ms"),
-pressureDelta("fuel: Injector pressure delta", SensorCategory.SENSOR_INPUTS, FieldType.INT, 968, 1.0, -1000.0, 1000.0, "kPa"),
-pressureRatio("fuel: Injector pressure ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT, 972, 1.0, 0.0, 100.0, ""),
-retardThresholdRpm("retardThresholdRpm", SensorCategory.SENSOR_INPUTS, FieldType.INT, 976, 1.0, -1.0, -1.0, ""),
-fuelALSCorrection("fuelALSCorrection", SensorCategory.SENSOR_INPUTS, FieldType.INT, 988, 1.0, -1.0, -1.0, ""),
-timingALSCorrection("timingALSCorrection", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 992, 0.01, -20.0, 20.0, "deg"),
-timingALSSkip("timingALSSkip", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 994, 0.01, 0.0, 50.0, "deg"),
-luaTargetAdd("Boost: Lua target add", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1000, 0.5, -100.0, 100.0, "v"),
-boostOutput("Boost: Output", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1002, 0.01, -100.0, 100.0, "percent"),
-luaTargetMult("Boost: Lua target mult", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1004, 1.0, -100.0, 100.0, "v"),
-openLoopPart("Boost: Open loop", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1008, 1.0, -100.0, 100.0, "v"),
-luaOpenLoopAdd("Boost: Lua open loop add", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1012, 1.0, -100.0, 100.0, "v"),
-boostControllerClosedLoopPart("Boost: Closed loop", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1016, 0.5, -50.0, 50.0, "%"),
-alignmentFill_at_21("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1017, 1.0, -20.0, 100.0, "units"),
-boostControlTarget("Boost: Target", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1018, 0.03333333333333333, 0.0, 300.0, "kPa"),
-acButtonState("AC switch", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1020, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_1("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1021, 1.0, -20.0, 100.0, "units"),
-latest_usage_ac_control("AC latest activity", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1028, 1.0, -1.0, -1.0, ""),
-acSwitchLastChangeTimeMs("acSwitchLastChangeTimeMs", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1032, 1.0, -1.0, -1.0, ""),
-lua("lua", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1048, 1.0, -1.0, -1.0, ""),
-sd("sd", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1060, 1.0, -1.0, -1.0, ""),
-crankingFuel("crankingFuel", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1068, 1.0, -1.0, -1.0, ""),
-baroCorrection("Fuel: Barometric pressure mult", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1084, 1.0, -1.0, -1.0, ""),
-hellenBoardId("Detected Board ID", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1088, 1.0, 0.0, 3000.0, "id"),
-clutchUpState("Clutch: up", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1090, 1.0, -1.0, -1.0, ""),
-clutchDownState("Clutch: down", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1091, 1.0, -1.0, -1.0, ""),
-brakePedalState("Brake switch", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1092, 1.0, -1.0, -1.0, ""),
-startStopState("startStopState", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1093, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_46("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1094, 1.0, -20.0, 100.0, "units"),
-startStopStateToggleCounter("startStopStateToggleCounter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1100, 1.0, -1.0, -1.0, ""),
-egtValue1("egtValue1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1104, 1.0, -1.0, -1.0, ""),
-egtValue2("egtValue2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1108, 1.0, -1.0, -1.0, ""),
-desiredRpmLimit("User-defined RPM hard limit", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1112, 1.0, 0.0, 30000.0, "rpm"),
-alignmentFill_at_66("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1114, 1.0, -20.0, 100.0, "units"),
-fuelInjectionCounter("Fuel: Injection counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1116, 1.0, -1.0, -1.0, ""),
-sparkCounter("Ign: Spark counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1120, 1.0, -1.0, -1.0, ""),
-fuelingLoad("Fuel: Load", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1124, 1.0, -1.0, -1.0, ""),
-ignitionLoad("Ignition: load", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1128, 1.0, -1.0, -1.0, ""),
-veTableYAxis("veTableYAxis", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1132, 0.01, 0.0, 0.0, "%"),
-alignmentFill_at_86("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1134, 1.0, -20.0, 100.0, "units"),
-tpsFrom("Fuel: TPS AE from", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1136, 1.0, -1.0, -1.0, ""),
-tpsTo("Fuel: TPS AE to", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1140, 1.0, -1.0, -1.0, ""),
-deltaTps("Fuel: TPS AE change", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1144, 1.0, -1.0, -1.0, ""),
-extraFuel("extraFuel", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1148, 1.0, -1.0, -1.0, ""),
-valueFromTable("valueFromTable", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1152, 1.0, -1.0, -1.0, ""),
-fractionalInjFuel("fractionalInjFuel", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1160, 1.0, -1.0, -1.0, ""),
-accumulatedValue("accumulatedValue", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1164, 1.0, -1.0, -1.0, ""),
-maxExtraPerCycle("maxExtraPerCycle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1168, 1.0, -1.0, -1.0, ""),
-maxExtraPerPeriod("maxExtraPerPeriod", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1172, 1.0, -1.0, -1.0, ""),
-maxInjectedPerPeriod("maxInjectedPerPeriod", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1176, 1.0, -1.0, -1.0, ""),
-cycleCnt("cycleCnt", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1180, 1.0, -1.0, -1.0, ""),
-hwEventCounters1("Hardware events since boot 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1184, 1.0, -1.0, -1.0, ""),
-hwEventCounters2("Hardware events since boot 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1188, 1.0, -1.0, -1.0, ""),
-hwEventCounters3("Hardware events since boot 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1192, 1.0, -1.0, -1.0, ""),
-hwEventCounters4("Hardware events since boot 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1196, 1.0, -1.0, -1.0, ""),
-hwEventCounters5("Hardware events since boot 5", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1200, 1.0, -1.0, -1.0, ""),
-hwEventCounters6("Hardware events since boot 6", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1204, 1.0, -1.0, -1.0, ""),
-vvtCamCounter("Sync: total cams front counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1208, 1.0, -1.0, -1.0, ""),
-mapVvt_MAP_AT_SPECIAL_POINT("mapVvt_MAP_AT_SPECIAL_POINT", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1212, 1.0, -10000.0, 10000.0, ""),
-mapVvt_MAP_AT_DIFF("mapVvt_MAP_AT_DIFF", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1216, 1.0, -10000.0, 10000.0, ""),
-mapVvt_MAP_AT_CYCLE_COUNT("mapVvt_MAP_AT_CYCLE_COUNT", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1220, 1.0, -10000.0, 10000.0, ""),
-mapVvt_map_peak("mapVvt_map_peak", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1221, 1.0, -10000.0, 10000.0, ""),
-alignmentFill_at_38("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1222, 1.0, -20.0, 100.0, "units"),
-currentEngineDecodedPhase("Sync: Engine Phase", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1224, 1.0, 0.0, 0.0, "deg"),
-triggerToothAngleError("Sync: trigger angle error", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1228, 1.0, -30.0, 30.0, "deg"),
-triggerIgnoredToothCount("triggerIgnoredToothCount", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1232, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_49("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1233, 1.0, -20.0, 100.0, "units"),
-mapCamPrevToothAngle("Sync: MAP: prev angle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1236, 1.0, -3000.0, 3000.0, "deg"),
-crankSynchronizationCounter("sync: Crank sync counter\nUsually matches crank revolutions", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1244, 1.0, -1.0, -1.0, ""),
-vvtSyncGapRatio("vvtSyncGapRatio", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1248, 1.0, -10000.0, 10000.0, ""),
-vvtToothDurations0("vvtToothDurations0", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1252, 1.0, 0.0, 100000.0, "us"),
-vvtCurrentPosition("vvtCurrentPosition", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1256, 1.0, -10000.0, 10000.0, "sync: Primary Cam Position"),
-vvtToothPosition1("vvtToothPosition 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1260, 1.0, -10000.0, 10000.0, "sync: Cam Tooth Position"),
-vvtToothPosition2("vvtToothPosition 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1264, 1.0, -10000.0, 10000.0, "sync: Cam Tooth Position"),
-vvtToothPosition3("vvtToothPosition 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1268, 1.0, -10000.0, 10000.0, "sync: Cam Tooth Position"),
-vvtToothPosition4("vvtToothPosition 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1272, 1.0, -10000.0, 10000.0, "sync: Cam Tooth Position"),
-triggerSyncGapRatio("Trigger Sync Latest Ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1276, 1.0, -10000.0, 10000.0, ""),
-triggerStateIndex("triggerStateIndex", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1280, 1.0, -1.0, -1.0, ""),
-camResyncCounter("sync: Phase Re-Sync Counter", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1281, 1.0, -1.0, -1.0, ""),
-vvtStateIndex("vvtStateIndex", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1282, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_39("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1283, 1.0, -20.0, 100.0, "units"),
-wallFuelCorrection("fuel wallwetting injection time\n correction to account for wall wetting effect for current cycle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1288, 1.0, -1.0, -1.0, ""),
-wallFuel("Fuel on the wall\nin ms of injector open time for each injector.", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1292, 1.0, -1.0, -1.0, ""),
-idleState("idleState", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1296, 1.0, -1.0, -1.0, ""),
-currentIdlePosition("Idle: Position", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1300, 1.0, 0.0, 0.0, "%"),
-baseIdlePosition("idle: base value\ncurrent position without adjustments (iacByTpsTaper, afterCrankingIACtaperDuration)", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1304, 1.0, -1.0, -1.0, ""),
-idleClosedLoop("Idle: Closed loop", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1308, 1.0, -1.0, -1.0, ""),
-iacByTpsTaper("idle: iacByTpsTaper portion", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1312, 1.0, -1.0, -1.0, ""),
-throttlePedalUpState("idle: throttlePedalUpState\ntrue in IDLE throttle pedal state, false if driver is touching the pedal\ntodo: better name for this field?", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1316, 1.0, -1.0, -1.0, ""),
-idleTarget("Idle: Target RPM", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1324, 1.0, -1.0, -1.0, ""),
-targetRpmByClt("Idle: Target RPM base", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1328, 1.0, -1.0, -1.0, ""),
-targetRpmAc("Idle: Target A/C RPM", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1332, 1.0, -1.0, -1.0, ""),
-iacByRpmTaper("idle: iacByRpmTaper portion", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1336, 1.0, -1.0, -1.0, ""),
-luaAdd("idle: Lua Adder", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1340, 1.0, -1.0, -1.0, ""),
-idlePosition("ETB: idlePosition", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1344, 1.0, 0.0, 10.0, "per"),
-trim("ETB: trim", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1348, 1.0, -1.0, -1.0, ""),
-luaAdjustment("ETB: luaAdjustment", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1352, 1.0, 0.0, 3.0, "per"),
-m_wastegatePosition("DC: wastegatePosition", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1356, 1.0, 0.0, 3.0, "per"),
-etbFeedForward("etbFeedForward", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1360, 1.0, -1.0, -1.0, ""),
-etbIntegralError("etbIntegralError", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1364, 1.0, -10000.0, 10000.0, ""),
-etbCurrentTarget("etbCurrentTarget", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1368, 1.0, -10000.0, 10000.0, "%"),
-etbCurrentAdjustedTarget("etbCurrentAdjustedTarget", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1372, 1.0, -10000.0, 10000.0, "%"),
-etbDutyRateOfChange("ETB duty rate of change", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1380, 1.0, 0.0, 25.0, "per"),
-etbDutyAverage("ETB average duty", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1384, 1.0, -20.0, 50.0, "per"),
-etbTpsErrorCounter("ETB TPS error counter", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1388, 1.0, 0.0, 3.0, "count"),
-etbPpsErrorCounter("ETB pedal error counter", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1390, 1.0, 0.0, 3.0, "count"),
-etbErrorCode("etbErrorCode", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1392, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_49("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1393, 1.0, -20.0, 100.0, "units"),
-jamTimer("ETB jam timer", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1394, 0.01, 0.0, 100.0, "sec"),
-faultCode("WBO: Fault code", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1396, 1.0, -1.0, -1.0, ""),
-heaterDuty("WBO: Heater duty", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1397, 1.0, 0.0, 100.0, "%"),
-pumpDuty("WBO: Pump duty", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1398, 1.0, 0.0, 100.0, "%"),
-alignmentFill_at_3("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1399, 1.0, -20.0, 100.0, "units"),
-tempC("WBO: Temperature", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1400, 1.0, 500.0, 1000.0, "C"),
-nernstVoltage("WBO: Nernst Voltage", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1402, 0.001, 0.0, 1.0, "V"),
-esr("WBO: ESR", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1404, 1.0, 0.0, 10000.0, "ohm"),
-alignmentFill_at_10("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1406, 1.0, -20.0, 100.0, "units"),
-dcOutput0("DC: output0", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1408, 1.0, 0.0, 10.0, "per"),
-isEnabled0_int("DC: en0", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1412, 1.0, 0.0, 10.0, "per"),
-alignmentFill_at_5("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1413, 1.0, -20.0, 100.0, "units"),
-value0("ETB: SENT value0", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1420, 1.0, 0.0, 3.0, "value"),
-value1("ETB: SENT value1", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1422, 1.0, 0.0, 3.0, "value"),
-errorRate("ETB: SENT error rate", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1424, 1.0, 0.0, 3.0, "ratio"),
-vvtTarget("vvtTarget", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1428, 0.1, -90.0, 90.0, "deg"),
-vvtOutput("vvtOutput", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1430, 0.5, 100.0, 1.0, "%"),
-alignmentFill_at_3("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1431, 1.0, -20.0, 100.0, "units"),
-lambdaTimeSinceGood("lambdaTimeSinceGood", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1436, 0.01, 0.0, 1.0, "sec"),
-alignmentFill_at_6("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1438, 1.0, -20.0, 100.0, "units"),
+m_knockDroppedWindows("Knock: Dropped windows", SensorCategory.SENSOR_INPUTS, FieldType.INT, 924, 1.0, 0.0, 0.0, ""),
+m_knockBand1("Knock: Band 1", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 928, 1.0, 0.0, 0.0, "dBv"),
+m_knockBand2("Knock: Band 2", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 929, 1.0, 0.0, 0.0, "dBv"),
+m_knockBand3("Knock: Band 3", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 930, 1.0, 0.0, 0.0, "dBv"),
+m_knockBand4("Knock: Band 4", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 931, 1.0, 0.0, 0.0, "dBv"),
+throttleModelCrossoverAngle("Air: Throttle crossover pos", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 936, 0.01, 0.0, 100.0, "%"),
+alignmentFill_at_6("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 938, 1.0, -20.0, 100.0, "units"),
+throttleEstimatedFlow("Air: Throttle flow estimate", SensorCategory.SENSOR_INPUTS, FieldType.INT, 940, 1.0, 0.0, 5.0, "g/s"),
+m_requested_pump("GDI: HPFP duration\nComputed requested pump duration in degrees (not including deadtime)", SensorCategory.SENSOR_INPUTS, FieldType.INT, 944, 1.0, -1.0, -1.0, ""),
+fuel_requested_percent("GDI: requested_percent", SensorCategory.SENSOR_INPUTS, FieldType.INT, 948, 1.0, -1.0, -1.0, ""),
+fuel_requested_percent_pi("GDI: percent_pi", SensorCategory.SENSOR_INPUTS, FieldType.INT, 952, 1.0, -1.0, -1.0, ""),
+m_pressureTarget_kPa("GDI: target pressure", SensorCategory.SENSOR_INPUTS, FieldType.INT, 960, 1.0, -1.0, -1.0, ""),
+nextLobe("GDI: nextLobe", SensorCategory.SENSOR_INPUTS, FieldType.INT, 964, 1.0, -1.0, -1.0, ""),
+di_nextStart("GDI: next start", SensorCategory.SENSOR_INPUTS, FieldType.INT, 968, 1.0, 0.0, 100.0, "v"),
+m_deadtime("Fuel: injector lag", SensorCategory.SENSOR_INPUTS, FieldType.INT, 972, 1.0, 0.0, 0.0, "ms"),
+pressureDelta("fuel: Injector pressure delta", SensorCategory.SENSOR_INPUTS, FieldType.INT, 976, 1.0, -1000.0, 1000.0, "kPa"),
+pressureRatio("fuel: Injector pressure ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT, 980, 1.0, 0.0, 100.0, ""),
+retardThresholdRpm("retardThresholdRpm", SensorCategory.SENSOR_INPUTS, FieldType.INT, 984, 1.0, -1.0, -1.0, ""),
+fuelALSCorrection("fuelALSCorrection", SensorCategory.SENSOR_INPUTS, FieldType.INT, 996, 1.0, -1.0, -1.0, ""),
+timingALSCorrection("timingALSCorrection", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1000, 0.01, -20.0, 20.0, "deg"),
+timingALSSkip("timingALSSkip", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1002, 0.01, 0.0, 50.0, "deg"),
+luaTargetAdd("Boost: Lua target add", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1008, 0.5, -100.0, 100.0, "v"),
+boostOutput("Boost: Output", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1010, 0.01, -100.0, 100.0, "percent"),
+luaTargetMult("Boost: Lua target mult", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1012, 1.0, -100.0, 100.0, "v"),
+openLoopPart("Boost: Open loop", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1016, 1.0, -100.0, 100.0, "v"),
+luaOpenLoopAdd("Boost: Lua open loop add", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1020, 1.0, -100.0, 100.0, "v"),
+boostControllerClosedLoopPart("Boost: Closed loop", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1024, 0.5, -50.0, 50.0, "%"),
+alignmentFill_at_21("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1025, 1.0, -20.0, 100.0, "units"),
+boostControlTarget("Boost: Target", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1026, 0.03333333333333333, 0.0, 300.0, "kPa"),
+acButtonState("AC switch", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1028, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_1("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1029, 1.0, -20.0, 100.0, "units"),
+latest_usage_ac_control("AC latest activity", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1036, 1.0, -1.0, -1.0, ""),
+acSwitchLastChangeTimeMs("acSwitchLastChangeTimeMs", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1040, 1.0, -1.0, -1.0, ""),
+lua("lua", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1056, 1.0, -1.0, -1.0, ""),
+sd("sd", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1068, 1.0, -1.0, -1.0, ""),
+crankingFuel("crankingFuel", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1076, 1.0, -1.0, -1.0, ""),
+baroCorrection("Fuel: Barometric pressure mult", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1092, 1.0, -1.0, -1.0, ""),
+hellenBoardId("Detected Board ID", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1096, 1.0, 0.0, 3000.0, "id"),
+clutchUpState("Clutch: up", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1098, 1.0, -1.0, -1.0, ""),
+clutchDownState("Clutch: down", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1099, 1.0, -1.0, -1.0, ""),
+brakePedalState("Brake switch", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1100, 1.0, -1.0, -1.0, ""),
+startStopState("startStopState", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1101, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_46("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1102, 1.0, -20.0, 100.0, "units"),
+startStopStateToggleCounter("startStopStateToggleCounter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1108, 1.0, -1.0, -1.0, ""),
+egtValue1("egtValue1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1112, 1.0, -1.0, -1.0, ""),
+egtValue2("egtValue2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1116, 1.0, -1.0, -1.0, ""),
+desiredRpmLimit("User-defined RPM hard limit", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1120, 1.0, 0.0, 30000.0, "rpm"),
+alignmentFill_at_66("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1122, 1.0, -20.0, 100.0, "units"),
+fuelInjectionCounter("Fuel: Injection counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1124, 1.0, -1.0, -1.0, ""),
+sparkCounter("Ign: Spark counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1128, 1.0, -1.0, -1.0, ""),
+fuelingLoad("Fuel: Load", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1132, 1.0, -1.0, -1.0, ""),
+ignitionLoad("Ignition: load", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1136, 1.0, -1.0, -1.0, ""),
+veTableYAxis("veTableYAxis", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1140, 0.01, 0.0, 0.0, "%"),
+alignmentFill_at_86("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1142, 1.0, -20.0, 100.0, "units"),
+tpsFrom("Fuel: TPS AE from", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1144, 1.0, -1.0, -1.0, ""),
+tpsTo("Fuel: TPS AE to", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1148, 1.0, -1.0, -1.0, ""),
+deltaTps("Fuel: TPS AE change", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1152, 1.0, -1.0, -1.0, ""),
+extraFuel("extraFuel", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1156, 1.0, -1.0, -1.0, ""),
+valueFromTable("valueFromTable", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1160, 1.0, -1.0, -1.0, ""),
+fractionalInjFuel("fractionalInjFuel", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1168, 1.0, -1.0, -1.0, ""),
+accumulatedValue("accumulatedValue", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1172, 1.0, -1.0, -1.0, ""),
+maxExtraPerCycle("maxExtraPerCycle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1176, 1.0, -1.0, -1.0, ""),
+maxExtraPerPeriod("maxExtraPerPeriod", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1180, 1.0, -1.0, -1.0, ""),
+maxInjectedPerPeriod("maxInjectedPerPeriod", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1184, 1.0, -1.0, -1.0, ""),
+cycleCnt("cycleCnt", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1188, 1.0, -1.0, -1.0, ""),
+hwEventCounters1("Hardware events since boot 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1192, 1.0, -1.0, -1.0, ""),
+hwEventCounters2("Hardware events since boot 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1196, 1.0, -1.0, -1.0, ""),
+hwEventCounters3("Hardware events since boot 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1200, 1.0, -1.0, -1.0, ""),
+hwEventCounters4("Hardware events since boot 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1204, 1.0, -1.0, -1.0, ""),
+hwEventCounters5("Hardware events since boot 5", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1208, 1.0, -1.0, -1.0, ""),
+hwEventCounters6("Hardware events since boot 6", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1212, 1.0, -1.0, -1.0, ""),
+vvtCamCounter("Sync: total cams front counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1216, 1.0, -1.0, -1.0, ""),
+mapVvt_MAP_AT_SPECIAL_POINT("mapVvt_MAP_AT_SPECIAL_POINT", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1220, 1.0, -10000.0, 10000.0, ""),
+mapVvt_MAP_AT_DIFF("mapVvt_MAP_AT_DIFF", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1224, 1.0, -10000.0, 10000.0, ""),
+mapVvt_MAP_AT_CYCLE_COUNT("mapVvt_MAP_AT_CYCLE_COUNT", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1228, 1.0, -10000.0, 10000.0, ""),
+mapVvt_map_peak("mapVvt_map_peak", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1229, 1.0, -10000.0, 10000.0, ""),
+alignmentFill_at_38("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1230, 1.0, -20.0, 100.0, "units"),
+currentEngineDecodedPhase("Sync: Engine Phase", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1232, 1.0, 0.0, 0.0, "deg"),
+triggerToothAngleError("Sync: trigger angle error", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1236, 1.0, -30.0, 30.0, "deg"),
+triggerIgnoredToothCount("triggerIgnoredToothCount", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1240, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_49("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1241, 1.0, -20.0, 100.0, "units"),
+mapCamPrevToothAngle("Sync: MAP: prev angle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1244, 1.0, -3000.0, 3000.0, "deg"),
+crankSynchronizationCounter("sync: Crank sync counter\nUsually matches crank revolutions", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1252, 1.0, -1.0, -1.0, ""),
+vvtSyncGapRatio("vvtSyncGapRatio", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1256, 1.0, -10000.0, 10000.0, ""),
+vvtToothDurations0("vvtToothDurations0", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1260, 1.0, 0.0, 100000.0, "us"),
+vvtCurrentPosition("vvtCurrentPosition", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1264, 1.0, -10000.0, 10000.0, "sync: Primary Cam Position"),
+vvtToothPosition1("vvtToothPosition 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1268, 1.0, -10000.0, 10000.0, "sync: Cam Tooth Position"),
+vvtToothPosition2("vvtToothPosition 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1272, 1.0, -10000.0, 10000.0, "sync: Cam Tooth Position"),
+vvtToothPosition3("vvtToothPosition 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1276, 1.0, -10000.0, 10000.0, "sync: Cam Tooth Position"),
+vvtToothPosition4("vvtToothPosition 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1280, 1.0, -10000.0, 10000.0, "sync: Cam Tooth Position"),
+triggerSyncGapRatio("Trigger Sync Latest Ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1284, 1.0, -10000.0, 10000.0, ""),
+triggerStateIndex("triggerStateIndex", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1288, 1.0, -1.0, -1.0, ""),
+camResyncCounter("sync: Phase Re-Sync Counter", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1289, 1.0, -1.0, -1.0, ""),
+vvtStateIndex("vvtStateIndex", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1290, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_39("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1291, 1.0, -20.0, 100.0, "units"),
+wallFuelCorrection("fuel wallwetting injection time\n correction to account for wall wetting effect for current cycle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1296, 1.0, -1.0, -1.0, ""),
+wallFuel("Fuel on the wall\nin ms of injector open time for each injector.", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1300, 1.0, -1.0, -1.0, ""),
+idleState("idleState", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1304, 1.0, -1.0, -1.0, ""),
+currentIdlePosition("Idle: Position", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1308, 1.0, 0.0, 0.0, "%"),
+baseIdlePosition("idle: base value\ncurrent position without adjustments (iacByTpsTaper, afterCrankingIACtaperDuration)", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1312, 1.0, -1.0, -1.0, ""),
+idleClosedLoop("Idle: Closed loop", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1316, 1.0, -1.0, -1.0, ""),
+iacByTpsTaper("idle: iacByTpsTaper portion", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1320, 1.0, -1.0, -1.0, ""),
+throttlePedalUpState("idle: throttlePedalUpState\ntrue in IDLE throttle pedal state, false if driver is touching the pedal\ntodo: better name for this field?", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1324, 1.0, -1.0, -1.0, ""),
+idleTarget("Idle: Target RPM", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1332, 1.0, -1.0, -1.0, ""),
+targetRpmByClt("Idle: Target RPM base", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1336, 1.0, -1.0, -1.0, ""),
+targetRpmAc("Idle: Target A/C RPM", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1340, 1.0, -1.0, -1.0, ""),
+iacByRpmTaper("idle: iacByRpmTaper portion", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1344, 1.0, -1.0, -1.0, ""),
+luaAdd("idle: Lua Adder", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1348, 1.0, -1.0, -1.0, ""),
+idlePosition("ETB: idlePosition", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1352, 1.0, 0.0, 10.0, "per"),
+trim("ETB: trim", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1356, 1.0, -1.0, -1.0, ""),
+luaAdjustment("ETB: luaAdjustment", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1360, 1.0, 0.0, 3.0, "per"),
+m_wastegatePosition("DC: wastegatePosition", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1364, 1.0, 0.0, 3.0, "per"),
+etbFeedForward("etbFeedForward", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1368, 1.0, -1.0, -1.0, ""),
+etbIntegralError("etbIntegralError", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1372, 1.0, -10000.0, 10000.0, ""),
+etbCurrentTarget("etbCurrentTarget", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1376, 1.0, -10000.0, 10000.0, "%"),
+etbCurrentAdjustedTarget("etbCurrentAdjustedTarget", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1380, 1.0, -10000.0, 10000.0, "%"),
+etbDutyRateOfChange("ETB duty rate of change", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1388, 1.0, 0.0, 25.0, "per"),
+etbDutyAverage("ETB average duty", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1392, 1.0, -20.0, 50.0, "per"),
+etbTpsErrorCounter("ETB TPS error counter", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1396, 1.0, 0.0, 3.0, "count"),
+etbPpsErrorCounter("ETB pedal error counter", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1398, 1.0, 0.0, 3.0, "count"),
+etbErrorCode("etbErrorCode", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1400, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_49("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1401, 1.0, -20.0, 100.0, "units"),
+jamTimer("ETB jam timer", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1402, 0.01, 0.0, 100.0, "sec"),
+faultCode("WBO: Fault code", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1404, 1.0, -1.0, -1.0, ""),
+heaterDuty("WBO: Heater duty", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1405, 1.0, 0.0, 100.0, "%"),
+pumpDuty("WBO: Pump duty", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1406, 1.0, 0.0, 100.0, "%"),
+alignmentFill_at_3("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1407, 1.0, -20.0, 100.0, "units"),
+tempC("WBO: Temperature", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1408, 1.0, 500.0, 1000.0, "C"),
+nernstVoltage("WBO: Nernst Voltage", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1410, 0.001, 0.0, 1.0, "V"),
+esr("WBO: ESR", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1412, 1.0, 0.0, 10000.0, "ohm"),
+alignmentFill_at_10("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1414, 1.0, -20.0, 100.0, "units"),
+dcOutput0("DC: output0", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1416, 1.0, 0.0, 10.0, "per"),
+isEnabled0_int("DC: en0", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1420, 1.0, 0.0, 10.0, "per"),
+alignmentFill_at_5("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1421, 1.0, -20.0, 100.0, "units"),
+value0("ETB: SENT value0", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1428, 1.0, 0.0, 3.0, "value"),
+value1("ETB: SENT value1", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1430, 1.0, 0.0, 3.0, "value"),
+errorRate("ETB: SENT error rate", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1432, 1.0, 0.0, 3.0, "ratio"),
+vvtTarget("vvtTarget", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1436, 0.1, -90.0, 90.0, "deg"),
+vvtOutput("vvtOutput", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1438, 0.5, 100.0, 1.0, "%"),
+alignmentFill_at_3("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1439, 1.0, -20.0, 100.0, "units"),
+lambdaTimeSinceGood("lambdaTimeSinceGood", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1444, 0.01, 0.0, 1.0, "sec"),
+alignmentFill_at_6("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1446, 1.0, -20.0, 100.0, "units"),
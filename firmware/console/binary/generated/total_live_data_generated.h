@@ -1,2 +1,2 @@
 // generated by gen_live_documentation.sh / LiveDataProcessor.java
-#define TS_TOTAL_OUTPUT_SIZE 1440
\ No newline at end of file
+#define TS_TOTAL_OUTPUT_SIZE 1448
\ No newline at end of file
@@ -1264,9 +1264,93 @@ struct output_channels_s {
 	 */
 	scaled_channel<uint16_t, 1000, 1> afr2GasolineScale = (uint16_t)0;
 	/**
+	 * Lua: onTick min duration
+	us
 	 * offset 684
 	 */
-	uint8_t unusedAtTheEnd[120];
+	uint16_t luaTickMinUs = (uint16_t)0;
+	/**
+	 * Lua: onTick avg duration
+	us
+	 * offset 686
+	 */
+	uint16_t luaTickAvgUs = (uint16_t)0;
+	/**
+	 * Lua: onTick max duration
+	us
+	 * offset 688
+	 */
+	uint16_t luaTickMaxUs = (uint16_t)0;
+	/**
+	 * Lua: onCanRx min duration
+	us
+	 * offset 690
+	 */
+	uint16_t luaCanRxMinUs = (uint16_t)0;
+	/**
+	 * Lua: onCanRx avg duration
+	us
+	 * offset 692
+	 */
+	uint16_t luaCanRxAvgUs = (uint16_t)0;
+	/**
+	 * Lua: onCanRx max duration
+	us
+	 * offset 694
+	 */
+	uint16_t luaCanRxMaxUs = (uint16_t)0;
+	/**
+	 * Lua: CAN callback min duration
+	us
+	 * offset 696
+	 */
+	uint16_t luaCanCallbackMinUs = (uint16_t)0;
+	/**
+	 * Lua: CAN callback avg duration
+	us
+	 * offset 698
+	 */
+	uint16_t luaCanCallbackAvgUs = (uint16_t)0;
+	/**
+	 * Lua: CAN callback max duration
+	us
+	 * offset 700
+	 */
+	uint16_t luaCanCallbackMaxUs = (uint16_t)0;
+	/**
+	 * Lua: hooks aborted over budget
+	count
+	 * offset 702
+	 */
+	uint16_t luaHookBudgetAborts = (uint16_t)0;
+	/**
+	 * Lua: script load duration
+	us
+	 * offset 704
+	 */
+	uint32_t luaLoadDuration = (uint32_t)0;
+	/**
+	 * Lua: loads from bytecode cache
+	count
+	 * offset 708
+	 */
+	uint16_t luaBytecodeCacheHits = (uint16_t)0;
+	/**
+	 * SD log: dropped records
+	count
+	 * offset 710
+	 */
+	uint16_t sdLogDroppedRecords = (uint16_t)0;
+	/**
+	 * SD log: max write latency
+	us
+	 * offset 712
+	 */
+	uint32_t sdLogMaxWriteLatency = (uint32_t)0;
+	/**
+	 * offset 716
+	 */
+	uint8_t unusedAtTheEnd[88];
 };
 static_assert(sizeof(output_channels_s) == 804);
 
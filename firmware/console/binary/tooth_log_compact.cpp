@@ -0,0 +1,97 @@
+/*
+ * @file tooth_log_compact.cpp
+ *
+ * See tooth_log_compact.h for the format, unit_tests/test-framework/tooth_log_decoder.cpp for the decoder.
+ */
+
+#include "pch.h"
+
+#include "tooth_log_compact.h"
+
+uint8_t getToothLogFlags(const composite_logger_s& entry) {
+	return entry.priLevel
+		| entry.secLevel << 1
+		| entry.trigger << 2
+		| entry.sync << 3
+		| entry.coil << 4
+		| entry.injector << 5;
+}
+
+void setToothLogFlags(composite_logger_s& entry, uint8_t flags) {
+	entry.priLevel = flags & (1 << 0);
+	entry.secLevel = flags & (1 << 1);
+	entry.trigger = flags & (1 << 2);
+	entry.sync = flags & (1 << 3);
+	entry.coil = flags & (1 << 4);
+	entry.injector = flags & (1 << 5);
+}
+
+static size_t putVarint(uint8_t* buffer, uint32_t value) {
+	size_t size = 0;
+	while (value >= 0x80) {
+		buffer[size++] = (value & 0x7F) | 0x80;
+		value >>= 7;
+	}
+	buffer[size++] = value;
+	return size;
+}
+
+static uint32_t getTimestamp(const composite_logger_s& entry) {
+	// TS byte order in the logger buffer
+	return SWAP_UINT32(entry.timestamp);
+}
+
+void writeToothLogCompact(Writer& out, const composite_logger_s* entries, size_t count) {
+	if (count == 0) {
+		return;
+	}
+
+	uint32_t previousTimestamp = getTimestamp(entries[0]);
+
+	uint8_t header[5];
+	header[0] = TOOTH_LOG_COMPACT_CHUNK_START;
+	header[1] = previousTimestamp & 0xFF;
+	header[2] = (previousTimestamp >> 8) & 0xFF;
+	header[3] = (previousTimestamp >> 16) & 0xFF;
+	header[4] = (previousTimestamp >> 24) & 0xFF;
+	out.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+	// first entry toggles from all flags off
+	uint8_t previousFlags = 0;
+
+	size_t runStart = 0;
+	while (runStart < count) {
+		uint8_t mask = getToothLogFlags(entries[runStart]) ^ previousFlags;
+
+		// extend the run while entries flip the same flags
+		uint8_t runFlags = getToothLogFlags(entries[runStart]);
+		size_t runEnd = runStart + 1;
+		while (runEnd < count) {
+			uint8_t flags = getToothLogFlags(entries[runEnd]);
+			if ((flags ^ runFlags) != mask) {
+				break;
+			}
+			runFlags = flags;
+			runEnd++;
+		}
+
+		uint8_t buffer[1 + TOOTH_LOG_VARINT_MAX_SIZE];
+		buffer[0] = mask;
+		size_t size = 1 + putVarint(buffer + 1, runEnd - runStart);
+		out.write(reinterpret_cast<const char*>(buffer), size);
+
+		for (size_t i = runStart; i < runEnd; i++) {
+			uint32_t timestamp = getTimestamp(entries[i]);
+			// entries from different interrupts may be slightly out of order
+			int32_t delta = timestamp - previousTimestamp;
+			uint32_t zigzag = (static_cast<uint32_t>(delta) << 1) ^ static_cast<uint32_t>(delta >> 31);
+			previousTimestamp = timestamp;
+
+			size = putVarint(buffer, zigzag);
+			out.write(reinterpret_cast<const char*>(buffer), size);
+		}
+
+		previousFlags = runFlags;
+		runStart = runEnd;
+	}
+}
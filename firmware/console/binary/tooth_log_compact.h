@@ -0,0 +1,61 @@
+/*
+ * @file tooth_log_compact.h
+ *
+ * Compact encoding of composite tooth logger entries for long captures.
+ *
+ * A chunk starts with TOOTH_LOG_COMPACT_CHUNK_START and the 32 bit timestamp of the first entry
+ * (little endian, microseconds). It is followed by runs:
+ *   toggle mask (1 byte, which flags flip from the previous entry)
+ *   entry count (varint)
+ *   entry count * zigzag varint timestamp delta from the previous entry
+ * Since a rising edge usually follows a falling edge, a whole revolution is typically one run
+ * and 1-2 bytes per entry instead of 5.
+ *
+ * Chunks are self contained, so they can be concatenated in a file or sent one per TS response.
+ */
+
+#pragma once
+
+#include "tooth_logger.h"
+#include "buffered_writer.h"
+
+// not a valid toggle mask, which only uses the low 6 bits
+#define TOOTH_LOG_COMPACT_CHUNK_START 0x81
+
+// a 32 bit varint takes up to 5 bytes
+#define TOOTH_LOG_VARINT_MAX_SIZE 5
+
+// worst case: every entry is a run of its own
+static constexpr size_t getToothLogCompactMaxSize(size_t entryCount) {
+	return 1 + 4 + entryCount * (1 + 1 + TOOTH_LOG_VARINT_MAX_SIZE);
+}
+
+uint8_t getToothLogFlags(const composite_logger_s& entry);
+void setToothLogFlags(composite_logger_s& entry, uint8_t flags);
+
+/**
+ * Writes one chunk with all 'count' entries
+ */
+void writeToothLogCompact(Writer& out, const composite_logger_s* entries, size_t count);
+
+/**
+ * Contiguous buffer for one encoded CompositeBuffer, for TS responses
+ */
+struct ToothLogCompactBuffer final : public Writer {
+	size_t write(const char* buffer, size_t count) override {
+		if (size + count > sizeof(data)) {
+			count = sizeof(data) - size;
+		}
+
+		memcpy(data + size, buffer, count);
+		size += count;
+		return count;
+	}
+
+	size_t flush() override {
+		return 0;
+	}
+
+	uint8_t data[getToothLogCompactMaxSize(toothLoggerEntriesPerBuffer)];
+	size_t size = 0;
+};
@@ -0,0 +1,14 @@
+/**
+ * @file ts_crc_cache.cpp
+ */
+
+#include "pch.h"
+
+#include "ts_crc_cache.h"
+
+// computed at compile time, lives in flash
+static constexpr Crc32Operator blockShift = getCrc32ShiftOperator(TS_CRC_BLOCK_SIZE);
+
+uint32_t crc32CombineBlock(uint32_t crcA, uint32_t crcB) {
+	return blockShift.apply(crcA) ^ crcB;
+}
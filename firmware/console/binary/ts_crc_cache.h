@@ -0,0 +1,122 @@
+/**
+ * @file ts_crc_cache.h
+ *
+ * TunerStudio polls the CRC of the whole configuration page. Instead of running crc32 over
+ * every byte each time, CRC of each fixed size block is kept until a write touches that block.
+ * Block CRCs are chained using the crc32 'append N zero bytes' operator, same math as zlib crc32_combine.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// power of two, see getCrc32ShiftOperator
+#define TS_CRC_BLOCK_SIZE 256
+
+struct Crc32Operator {
+	uint32_t rows[32];
+
+	constexpr uint32_t apply(uint32_t vec) const {
+		uint32_t sum = 0;
+		for (int i = 0; vec; i++, vec >>= 1) {
+			if (vec & 1) {
+				sum ^= rows[i];
+			}
+		}
+		return sum;
+	}
+
+	constexpr Crc32Operator squared() const {
+		Crc32Operator result = {};
+		for (int i = 0; i < 32; i++) {
+			result.rows[i] = apply(rows[i]);
+		}
+		return result;
+	}
+};
+
+/**
+ * @return operator which moves a crc32 over 'byteCount' zero bytes
+ */
+constexpr Crc32Operator getCrc32ShiftOperator(size_t byteCount) {
+	// one zero bit: reflected CRC-32 polynomial
+	Crc32Operator result = {};
+	result.rows[0] = 0xEDB88320;
+	for (int i = 1; i < 32; i++) {
+		result.rows[i] = 1U << (i - 1);
+	}
+
+	// 8 bits per byte, then double until byteCount
+	for (size_t bits = 1; bits < byteCount * 8; bits *= 2) {
+		result = result.squared();
+	}
+
+	return result;
+}
+
+/**
+ * @return crc32 of A followed by B given crc32 of A and crc32 of B, B being TS_CRC_BLOCK_SIZE bytes long
+ */
+uint32_t crc32CombineBlock(uint32_t crcA, uint32_t crcB);
+
+template <size_t TPageSize>
+class TsPageCrcCache {
+public:
+	uint32_t getCrc(const uint8_t* page, size_t offset, size_t count) {
+		size_t end = offset + count;
+
+		// head up to the first block boundary
+		size_t pos = (offset + TS_CRC_BLOCK_SIZE - 1) / TS_CRC_BLOCK_SIZE * TS_CRC_BLOCK_SIZE;
+		if (pos > end) {
+			pos = end;
+		}
+		uint32_t crc = crc32inc((void*)(page + offset), 0, pos - offset);
+
+		for (; pos + TS_CRC_BLOCK_SIZE <= end; pos += TS_CRC_BLOCK_SIZE) {
+			crc = crc32CombineBlock(crc, getBlockCrc(page, pos / TS_CRC_BLOCK_SIZE));
+		}
+
+		// tail, including the short last block of the page
+		return crc32inc((void*)(page + pos), crc, end - pos);
+	}
+
+	void invalidate(size_t offset, size_t count) {
+		if (count == 0) {
+			return;
+		}
+
+		for (size_t block = offset / TS_CRC_BLOCK_SIZE; block <= (offset + count - 1) / TS_CRC_BLOCK_SIZE && block < blockCount; block++) {
+			m_isValid[block] = false;
+		}
+	}
+
+	void invalidateAll() {
+		for (size_t block = 0; block < blockCount; block++) {
+			m_isValid[block] = false;
+		}
+	}
+
+	// how many times a block CRC had to be computed, for tests and statistics
+	uint32_t getBlockComputeCounter() const {
+		return m_blockComputeCounter;
+	}
+
+private:
+	uint32_t getBlockCrc(const uint8_t* page, size_t block) {
+		if (!m_isValid[block]) {
+			m_blockCrc[block] = crc32((void*)(page + block * TS_CRC_BLOCK_SIZE), TS_CRC_BLOCK_SIZE);
+			m_isValid[block] = true;
+			m_blockComputeCounter++;
+		}
+
+		return m_blockCrc[block];
+	}
+
+	// only whole blocks are cached
+	static constexpr size_t blockCount = TPageSize / TS_CRC_BLOCK_SIZE;
+
+	uint32_t m_blockCrc[blockCount];
+	bool m_isValid[blockCount] = {};
+	uint32_t m_blockComputeCounter = 0;
+};
@@ -74,6 +74,7 @@
 #include "bluetooth.h"
 #include "tunerstudio_io.h"
 #include "trigger_scope.h"
+#include "tooth_log_compact.h"
 #include "electronic_throttle.h"
 #include "live_data.h"
 
@@ -165,6 +166,18 @@ bool validateOffsetCount(size_t offset, size_t count, TsChannelBase* tsChannel);
 
 extern bool rebootForPresetPending;
 
+#if EFI_PROD_CODE || EFI_SIMULATOR
+// TS channels run on their own threads but share tsInstance and its page CRC cache
+static chibios_rt::Mutex pageCrcMutex;
+#endif
+
+// a page write must not land between hashing a block and marking it valid
+struct PageCrcLocker {
+#if EFI_PROD_CODE || EFI_SIMULATOR
+	chibios_rt::MutexLocker lock{pageCrcMutex};
+#endif
+};
+
 /**
  * This command is needed to make the whole transfer a bit faster
  * @note See also handleWriteValueCommand
@@ -185,8 +198,10 @@ void TunerStudio::handleWriteChunkCommand(TsChannelBase* tsChannel, ts_response_
 
 	// Skip the write if a preset was just loaded - we don't want to overwrite it
 	if (!rebootForPresetPending) {
+		PageCrcLocker lock;
 		uint8_t * addr = (uint8_t *) (getWorkingPageAddr() + offset);
 		memcpy(addr, content, count);
+		m_pageCrcCache.invalidate(offset, count);
 	}
 	// Force any board configuration options that humans shouldn't be able to change
 	setBoardConfigOverrides();
@@ -194,6 +209,13 @@ void TunerStudio::handleWriteChunkCommand(TsChannelBase* tsChannel, ts_response_
 	sendOkResponse(tsChannel, mode);
 }
 
+// bumped by configuration changes which would otherwise leave cached page CRC stale
+static volatile uint32_t pageCrcInvalidateCounter = 0;
+
+void invalidateTsPageCrc() {
+	pageCrcInvalidateCounter++;
+}
+
 #if EFI_TUNER_STUDIO
 
 void TunerStudio::handleCrc32Check(TsChannelBase *tsChannel, ts_response_format_e mode, uint16_t offset, uint16_t count) {
@@ -204,9 +226,20 @@ void TunerStudio::handleCrc32Check(TsChannelBase *tsChannel, ts_response_format_
 		return;
 	}
 
-	const uint8_t* start = getWorkingPageAddr() + offset;
+	PageCrcLocker lock;
+
+	// configuration changes from anywhere but TS writes bump the global version or call invalidateTsPageCrc,
+	// counter is read before hashing so that a change while we hash is caught by the next check
+	uint32_t invalidateCounter = pageCrcInvalidateCounter;
+	if (m_pageCrcConfigVersion != engine->getGlobalConfigurationVersion()
+			|| m_pageCrcInvalidateCounter != invalidateCounter) {
+		m_pageCrcConfigVersion = engine->getGlobalConfigurationVersion();
+		m_pageCrcInvalidateCounter = invalidateCounter;
+		m_pageCrcCache.invalidateAll();
+	}
 
-	uint32_t crc = SWAP_UINT32(crc32(start, count));
+	// only blocks touched since the previous check are read
+	uint32_t crc = SWAP_UINT32(m_pageCrcCache.getCrc(getWorkingPageAddr(), offset, count));
 	tsChannel->sendResponse(mode, (const uint8_t *) &crc, 4);
 }
 
@@ -282,7 +315,9 @@ void TunerStudio::handleWriteValueCommand(TsChannelBase* tsChannel, ts_response_
 
 	// Skip the write if a preset was just loaded - we don't want to overwrite it
 	if (!rebootForPresetPending) {
+		PageCrcLocker lock;
 		getWorkingPageAddr()[offset] = value;
+		m_pageCrcCache.invalidate(offset, 1);
 	}
 	// Force any board configuration options that humans shouldn't be able to change
 	setBoardConfigOverrides();
@@ -372,6 +407,7 @@ static bool isKnownCommand(char command) {
 			|| command == TS_GET_FIRMWARE_VERSION
 			|| command == TS_PERF_TRACE_BEGIN
 			|| command == TS_PERF_TRACE_GET_BUFFER
+			|| command == TS_PERF_TRACE_STREAM
 			|| command == TS_GET_CONFIG_ERROR;
 }
 
@@ -660,6 +696,11 @@ void TunerStudio::handleExecuteCommand(TsChannelBase* tsChannel, char *data, int
 	tsChannel->writeCrcPacket(TS_RESPONSE_COMMAND_OK, nullptr, 0);
 }
 
+#if EFI_TOOTH_LOGGER
+// only used from the TS thread
+static ToothLogCompactBuffer compactToothBuffer;
+#endif // EFI_TOOTH_LOGGER
+
 int TunerStudio::handleCrcCommand(TsChannelBase* tsChannel, char *data, int incomingPacketSize) {
 	ScopePerf perf(PE::TunerStudioHandleCrcCommand);
 
@@ -760,6 +801,22 @@ int TunerStudio::handleCrcCommand(TsChannelBase* tsChannel, char *data, int inco
 				}
 			}
 			break;
+		case TS_COMPOSITE_READ_COMPACT:
+			{
+				auto toothBuffer = GetToothLoggerBufferNonblocking();
+
+				if (toothBuffer) {
+					compactToothBuffer.size = 0;
+					writeToothLogCompact(compactToothBuffer, toothBuffer->buffer, toothBuffer->nextIdx);
+					ReturnToothLoggerBuffer(toothBuffer);
+
+					tsChannel->sendResponse(TS_CRC, compactToothBuffer.data, compactToothBuffer.size, true);
+				} else {
+					// TS asked for a tooth logger buffer, but we don't have one to give it.
+					sendErrorCode(tsChannel, TS_RESPONSE_OUT_OF_RANGE);
+				}
+			}
+			break;
 #ifdef TRIGGER_SCOPE
 		case TS_TRIGGER_SCOPE_ENABLE:
 			triggerScopeEnable();
@@ -821,6 +878,39 @@ int TunerStudio::handleCrcCommand(TsChannelBase* tsChannel, char *data, int inco
 			tsChannel->sendResponse(TS_CRC, trace.get<uint8_t>(), trace.size(), true);
 		}
 
+		break;
+	case TS_PERF_TRACE_STREAM:
+		if (incomingPacketSize < 2) {
+			// sub-command byte is missing
+			sendErrorCode(tsChannel, TS_RESPONSE_UNDERRUN);
+			break;
+		}
+
+		switch (data[0]) {
+		case TS_PERF_TRACE_STREAM_START:
+			perfTraceStreamStart();
+			break;
+		case TS_PERF_TRACE_STREAM_STOP:
+			perfTraceStreamStop();
+			break;
+		case TS_PERF_TRACE_STREAM_READ:
+			{
+				size_t size;
+				const uint8_t* chunk = perfTraceStreamGetChunk(size);
+
+				if (chunk) {
+					tsChannel->sendResponse(TS_CRC, chunk, size, true);
+					perfTraceStreamReleaseChunk();
+					return true;
+				}
+				// nothing to read yet, empty OK response and the host polls again
+			}
+			break;
+		default:
+			return false;
+		}
+
+		sendOkResponse(tsChannel, TS_CRC);
 		break;
 #endif /* ENABLE_PERF_TRACE */
 	case TS_GET_CONFIG_ERROR: {
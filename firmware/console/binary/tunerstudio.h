@@ -32,6 +32,9 @@ void tunerStudioError(TsChannelBase* tsChannel, const char *msg);
 uint8_t* getWorkingPageAddr();
 
 void requestBurn();
+// Configuration was changed by something which neither writes through TS nor bumps the configuration
+// version, for instance console setters or Lua setCalibration: TS needs to see a fresh CRC
+void invalidateTsPageCrc();
 // Lua script might want to know how long since last TS request to see if unit is being actively monitored
 int getSecondsSinceChannelsRequest();
 
@@ -6,6 +6,8 @@
 
 #include <cstdint>
 
+#include "ts_crc_cache.h"
+
 class TsChannelBase;
 
 typedef enum {
@@ -40,6 +42,14 @@ public:
 	void handlePageReadCommand(TsChannelBase* tsChannel, ts_response_format_e mode, uint16_t offset, uint16_t count);
 	void handleScatteredReadCommand(TsChannelBase* tsChannel);
 
+	uint32_t getPageCrcBlockComputeCounter() const {
+		return m_pageCrcCache.getBlockComputeCounter();
+	}
+
 private:
 	void sendErrorCode(TsChannelBase* tsChannel, uint8_t code);
+
+	TsPageCrcCache<TOTAL_CONFIG_SIZE> m_pageCrcCache;
+	int m_pageCrcConfigVersion = -1;
+	uint32_t m_pageCrcInvalidateCounter = 0;
 };
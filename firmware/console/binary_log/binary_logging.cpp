@@ -6,7 +6,7 @@
 #include "pch.h"
 
 #include "binary_logging.h"
-#include "log_field.h"
+#include "log_field_set.h"
 #include "buffered_writer.h"
 #include "tunerstudio.h"
 
@@ -20,36 +20,53 @@ static scaled_channel<uint32_t, TIME_PRECISION> packedTime;
 // The list of logged fields lives in a separate file so it can eventually be tool-generated
 #include "log_fields_generated.h"
 
-static constexpr uint16_t computeFieldsRecordLength() {
-	uint16_t recLength = 0;
-	for (size_t i = 0; i < efi::size(fields); i++) {
-		recLength += fields[i].getSize();
-	}
+static LogFieldSet<efi::size(fields)> fieldSet(fields);
 
-	return recLength;
+/**
+ * Fields which change every engine cycle are written with every record,
+ * everything else only with every sdCardLogSlowDivider'th record.
+ */
+static void setFastFields() {
+	fieldSet.clearFastFields();
+
+	fieldSet.setFast(packedTime);
+	fieldSet.setFast(engine->outputChannels.RPMValue);
+	fieldSet.setFast(engine->outputChannels.rpmAcceleration);
+	fieldSet.setFast(engine->outputChannels.TPSValue);
+	fieldSet.setFast(engine->outputChannels.throttlePedalPosition);
+	fieldSet.setFast(engine->outputChannels.MAPValue);
+	fieldSet.setFast(engine->outputChannels.lambdaValue);
+	fieldSet.setFast(engine->outputChannels.lambdaValue2);
+	fieldSet.setFast(engine->outputChannels.actualLastInjection);
+	fieldSet.setFast(engine->outputChannels.etbTarget);
+	fieldSet.setFast(engine->outputChannels.etb1DutyCycle);
+	fieldSet.setFast(engine->ignitionState.baseIgnitionAdvance);
+	for (const auto& advance : engine->outputChannels.ignitionAdvanceCyl) {
+		fieldSet.setFast(advance);
+	}
+	auto knock = engine->module<KnockController>();
+	fieldSet.setFast(knock->m_knockLevel);
+	for (const auto& level : knock->m_knockCyl) {
+		fieldSet.setFast(level);
+	}
 }
 
-static uint64_t binaryLogCount = 0;
-
-extern bool main_loop_started;
-
 void writeSdLogLine(Writer& bufferedWriter) {
-	if (!main_loop_started)
-		return;
-
-	if (binaryLogCount == 0) {
-		writeFileHeader(bufferedWriter);
-	} else {
-		updateTunerStudioState();
-		writeSdBlock(bufferedWriter);
-	}
-
-	binaryLogCount++;
+	updateTunerStudioState();
+	writeSdBlock(bufferedWriter);
 }
 
-static constexpr uint16_t recordLength = computeFieldsRecordLength();
+static uint8_t blockRollCounter = 0;
+// records written since the last one with all fields
+static int recordsSinceFull = 0;
+
+void writeFileHeader(Writer& outBuffer, size_t dataAlignment) {
+	setFastFields();
+	// every file starts with a full record
+	recordsSinceFull = 0;
+
+	uint16_t recordLength = fieldSet.getRecordLength();
 
-void writeFileHeader(Writer& outBuffer) {
 	char buffer[MLQ_HEADER_SIZE];
 	// File format: MLVLG\0
 	strncpy(buffer, "MLVLG", 6);
@@ -64,19 +81,23 @@ void writeFileHeader(Writer& outBuffer) {
 	buffer[10] = 0;
 	buffer[11] = 0;
 
-	// Info data start
-	buffer[12] = 0;
-	buffer[13] = 0;
-	buffer[14] = 0;
-	buffer[15] = 0;
-
 	size_t headerSize = MLQ_HEADER_SIZE + efi::size(fields) * MLQ_FIELD_HEADER_SIZE;
-
-	// Data begin index: begins immediately after the header
-	buffer[16] = 0;
-	buffer[17] = 0;
-	buffer[18] = (headerSize >> 8) & 0xFF;
-	buffer[19] = headerSize & 0xFF;
+	// records start at a multiple of dataAlignment, the gap is an empty info text
+	size_t paddingSize = (dataAlignment - headerSize % dataAlignment) % dataAlignment;
+	size_t dataStart = headerSize + paddingSize;
+
+	// Info data start: no info unless there is padding
+	size_t infoStart = paddingSize ? headerSize : 0;
+	buffer[12] = (infoStart >> 24) & 0xFF;
+	buffer[13] = (infoStart >> 16) & 0xFF;
+	buffer[14] = (infoStart >> 8) & 0xFF;
+	buffer[15] = infoStart & 0xFF;
+
+	// Data begin index
+	buffer[16] = (dataStart >> 24) & 0xFF;
+	buffer[17] = (dataStart >> 16) & 0xFF;
+	buffer[18] = (dataStart >> 8) & 0xFF;
+	buffer[19] = dataStart & 0xFF;
 
 	// Record length - length of a single data record: sum size of all fields
 	buffer[20] = recordLength >> 8;
@@ -89,52 +110,35 @@ void writeFileHeader(Writer& outBuffer) {
 
 	outBuffer.write(buffer, MLQ_HEADER_SIZE);
 
-	// Write the actual logger fields, offset 22
-	for (size_t i = 0; i < efi::size(fields); i++) {
-		fields[i].writeHeader(outBuffer);
+	// Write the actual logger fields, offset 22, fast group first
+	fieldSet.writeHeaders(outBuffer);
+
+	memset(buffer, 0, sizeof(buffer));
+	while (paddingSize) {
+		size_t chunk = paddingSize < sizeof(buffer) ? paddingSize : sizeof(buffer);
+		outBuffer.write(buffer, chunk);
+		paddingSize -= chunk;
 	}
 }
 
-static uint8_t blockRollCounter = 0;
-
 //static efitimeus_t prevSdCardLineTime = 0;
 
 void writeSdBlock(Writer& outBuffer) {
-	static char buffer[16];
-
-	// Offset 0 = Block type, standard data block in this case
-	buffer[0] = 0;
-
-	// Offset 1 = rolling counter sequence number
-	buffer[1] = blockRollCounter++;
-
-	// Offset 2, size 2 = Timestamp at 10us resolution
+	// Timestamp at 10us resolution
 	efitimeus_t nowUs = getTimeNowUs();
 	uint16_t timestamp = nowUs / 10;
-	buffer[2] = timestamp >> 8;
-	buffer[3] = timestamp & 0xFF;
-
-	outBuffer.write(buffer, 4);
 
 	// todo: add a log field for SD card period
 //	prevSdCardLineTime = nowUs;
 
 	packedTime = getTimeNowMs() * 1.0 / TIME_PRECISION;
 
-	uint8_t sum = 0;
-	for (size_t fieldIndex = 0; fieldIndex < efi::size(fields); fieldIndex++) {
-		size_t entrySize = fields[fieldIndex].writeData(buffer);
-
-		for (size_t byteIndex = 0; byteIndex < entrySize; byteIndex++) {
-			// "CRC" at the end is just the sum of all bytes
-			sum += buffer[byteIndex];
-		}
-		outBuffer.write(buffer, entrySize);
-	}
+	// zero in tunes from before the setting existed
+	int slowDivider = maxI(1, engineConfiguration->sdCardLogSlowDivider);
+	bool isFullRecord = recordsSinceFull == 0 || recordsSinceFull >= slowDivider;
+	recordsSinceFull = isFullRecord ? 1 : recordsSinceFull + 1;
 
-	buffer[0] = sum;
-	// 1 byte checksum footer
-	outBuffer.write(buffer, 1);
+	fieldSet.writeBlock(outBuffer, isFullRecord, blockRollCounter++, timestamp);
 }
 
 #endif /* EFI_FILE_LOGGING */
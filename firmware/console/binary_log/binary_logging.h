@@ -5,6 +5,7 @@
 #include <cstddef>
 
 struct Writer;
-void writeFileHeader(Writer& buffer);
+// dataAlignment: records start at a multiple of this file offset
+void writeFileHeader(Writer& buffer, size_t dataAlignment = 1);
 void writeSdLogLine(Writer& buffer);
 void writeSdBlock(Writer& outBuffer);
@@ -0,0 +1,138 @@
+/**
+ * @file log_field_set.h
+ *
+ * Multi-rate binary log: fields are split into a fast group written with every record and a slow
+ * group written only with every Nth record.
+ *
+ * Fast fields go first in the file header, so a fast-only record is a prefix of the full record.
+ * Fast-only records use block type MLQ_BLOCK_TYPE_FAST_DATA, a rusEFI extension of MLG v2 which
+ * also carries the prefix length. With a divider of 1 every block is a standard data block.
+ */
+
+#pragma once
+
+#include "log_field.h"
+#include "buffered_writer.h"
+
+// MLG v2 standard data block: all fields
+#define MLQ_BLOCK_TYPE_DATA 0
+// rusEFI extension: fast fields only
+#define MLQ_BLOCK_TYPE_FAST_DATA 2
+
+template <size_t TCount>
+class LogFieldSet {
+public:
+	explicit constexpr LogFieldSet(const LogField (&fields)[TCount])
+		: m_fields(fields)
+	{
+	}
+
+	void clearFastFields() {
+		for (size_t i = 0; i < TCount; i++) {
+			m_isFast[i] = false;
+		}
+		m_fastRecordLength = 0;
+	}
+
+	// Moves every field which logs this channel into the fast group
+	template <typename TValue, int TMult, int TDiv>
+	void setFast(const scaled_channel<TValue, TMult, TDiv>& channel) {
+		setFastAddr(channel.getFirstByteAddr());
+	}
+
+	template <typename TValue, typename = typename std::enable_if<std::is_arithmetic_v<TValue>>::type>
+	void setFast(const TValue& value) {
+		setFastAddr(&value);
+	}
+
+	void setFastAddr(const void* addr) {
+		for (size_t i = 0; i < TCount; i++) {
+			if (!m_isFast[i] && m_fields[i].getAddr() == addr) {
+				m_isFast[i] = true;
+				m_fastRecordLength += m_fields[i].getSize();
+			}
+		}
+	}
+
+	size_t getRecordLength() const {
+		size_t result = 0;
+		for (size_t i = 0; i < TCount; i++) {
+			result += m_fields[i].getSize();
+		}
+		return result;
+	}
+
+	size_t getFastRecordLength() const {
+		return m_fastRecordLength;
+	}
+
+	void writeHeaders(Writer& outBuffer) const {
+		forEachField(/*fastOnly*/ false, [&](const LogField& field) {
+			field.writeHeader(outBuffer);
+		});
+	}
+
+	void writeBlock(Writer& outBuffer, bool isFullRecord, uint8_t rollCounter, uint16_t timestamp) const {
+		char buffer[16];
+
+		// Offset 0 = Block type
+		buffer[0] = isFullRecord ? MLQ_BLOCK_TYPE_DATA : MLQ_BLOCK_TYPE_FAST_DATA;
+
+		// Offset 1 = rolling counter sequence number
+		buffer[1] = rollCounter;
+
+		// Offset 2, size 2 = Timestamp at 10us resolution
+		buffer[2] = timestamp >> 8;
+		buffer[3] = timestamp & 0xFF;
+
+		size_t headerSize = 4;
+		if (!isFullRecord) {
+			// Offset 4, size 2 = length of the fast prefix of the record
+			buffer[4] = m_fastRecordLength >> 8;
+			buffer[5] = m_fastRecordLength & 0xFF;
+			headerSize = 6;
+		}
+
+		outBuffer.write(buffer, headerSize);
+
+		uint8_t sum = 0;
+		forEachField(!isFullRecord, [&](const LogField& field) {
+			size_t entrySize = field.writeData(buffer);
+
+			for (size_t byteIndex = 0; byteIndex < entrySize; byteIndex++) {
+				// "CRC" at the end is just the sum of all bytes
+				sum += buffer[byteIndex];
+			}
+			outBuffer.write(buffer, entrySize);
+		});
+
+		buffer[0] = sum;
+		// 1 byte checksum footer
+		outBuffer.write(buffer, 1);
+	}
+
+private:
+	// fast group first, then slow group, each in declaration order
+	template <typename TFunc>
+	void forEachField(bool fastOnly, TFunc func) const {
+		for (size_t i = 0; i < TCount; i++) {
+			if (m_isFast[i]) {
+				func(m_fields[i]);
+			}
+		}
+
+		if (fastOnly) {
+			return;
+		}
+
+		for (size_t i = 0; i < TCount; i++) {
+			if (!m_isFast[i]) {
+				func(m_fields[i]);
+			}
+		}
+	}
+
+	const LogField (&m_fields)[TCount];
+	bool m_isFast[TCount] = {};
+	size_t m_fastRecordLength = 0;
+};
@@ -279,6 +279,20 @@ static constexpr LogField fields[] = {
 	{engine->outputChannels.distanceTraveled, "distanceTraveled", "km", 1},
 	{engine->outputChannels.afrGasolineScale, "Air/Fuel Ratio (Gas Scale)", "AFR", 2},
 	{engine->outputChannels.afr2GasolineScale, "Air/Fuel Ratio 2 (Gas Scale)", "AFR", 2},
+	{engine->outputChannels.luaTickMinUs, "Lua: onTick min duration", "us", 0},
+	{engine->outputChannels.luaTickAvgUs, "Lua: onTick avg duration", "us", 0},
+	{engine->outputChannels.luaTickMaxUs, "Lua: onTick max duration", "us", 0},
+	{engine->outputChannels.luaCanRxMinUs, "Lua: onCanRx min duration", "us", 0},
+	{engine->outputChannels.luaCanRxAvgUs, "Lua: onCanRx avg duration", "us", 0},
+	{engine->outputChannels.luaCanRxMaxUs, "Lua: onCanRx max duration", "us", 0},
+	{engine->outputChannels.luaCanCallbackMinUs, "Lua: CAN callback min duration", "us", 0},
+	{engine->outputChannels.luaCanCallbackAvgUs, "Lua: CAN callback avg duration", "us", 0},
+	{engine->outputChannels.luaCanCallbackMaxUs, "Lua: CAN callback max duration", "us", 0},
+	{engine->outputChannels.luaHookBudgetAborts, "Lua: hooks aborted over budget", "count", 0},
+	{engine->outputChannels.luaLoadDuration, "Lua: script load duration", "us", 0},
+	{engine->outputChannels.luaBytecodeCacheHits, "Lua: loads from bytecode cache", "count", 0},
+	{engine->outputChannels.sdLogDroppedRecords, "SD log: dropped records", "count", 0},
+	{engine->outputChannels.sdLogMaxWriteLatency, "SD log: max write latency", "us", 0},
 #if EFI_ENGINE_CONTROL
 	{engine->fuelComputer.totalFuelCorrection, "Fuel: Total correction", "mult", 2, "Fuel: math"},
 #endif
@@ -349,6 +363,11 @@ static constexpr LogField fields[] = {
 	{___engine.module<KnockController>()->m_knockThreshold, "Knock: Threshold", "", 0},
 	{___engine.module<KnockController>()->m_knockCount, "Knock: Count", "", 0},
 	{___engine.module<KnockController>()->m_maximumRetard, "Knock: Max retard", "", 0},
+	{___engine.module<KnockController>()->m_knockDroppedWindows, "Knock: Dropped windows", "", 0},
+	{___engine.module<KnockController>()->m_knockBand[0], "Knock: Band 1", "dBv", 0},
+	{___engine.module<KnockController>()->m_knockBand[1], "Knock: Band 2", "dBv", 0},
+	{___engine.module<KnockController>()->m_knockBand[2], "Knock: Band 3", "dBv", 0},
+	{___engine.module<KnockController>()->m_knockBand[3], "Knock: Band 4", "dBv", 0},
 #if EFI_BOOST_CONTROL
 	{___engine.module<BoostController>()->luaTargetAdd, "Boost: Lua target add", "v", 1, "Boost Control"},
 #endif
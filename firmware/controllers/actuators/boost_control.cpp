@@ -45,6 +45,10 @@ void BoostController::onConfigurationChange(engine_configuration_s const * previ
 	}
 }
 
+bool BoostController::isConfigurationChangeRelevant(ConfigChangeTracker const & changes) {
+	return changes.isChanged(CONFIG_RANGE(boostPid));
+}
+
 expected<float> BoostController::observePlant() {
     expected<float> map = Sensor::get(SensorType::Map);
     if (!map.Valid && engineConfiguration->boostType != CLOSED_LOOP) {
@@ -23,6 +23,7 @@ public:
 	// Called when the configuration may have changed.  Controller will
 	// reset if necessary.
 	void onConfigurationChange(engine_configuration_s const * previousConfig) override;
+	bool isConfigurationChangeRelevant(ConfigChangeTracker const & changes) override;
 
 	// Helpers for individual parts of boost control
 	expected<float> observePlant() override;
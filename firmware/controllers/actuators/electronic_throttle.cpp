@@ -955,6 +955,27 @@ void setDefaultEtbParameters() {
 	engineConfiguration->etb_iTermMax = 30;
 }
 
+/**
+ * Everything doInitElectronicThrottle and EtbController::onConfigurationChange read,
+ * including which throttle and pedal sensors exist
+ */
+bool isElectronicThrottleConfigurationChanged(ConfigChangeTracker const & changes) {
+	return changes.isChanged({
+		CONFIG_RANGE(etbFunctions),
+		CONFIG_RANGE(etbIo),
+		CONFIG_RANGE(etb),
+		CONFIG_RANGE(etbWastegatePid),
+		CONFIG_RANGE(etbExpAverageLength),
+		CONFIG_RANGE(etbRocExpAverageLength),
+		CONFIG_RANGE(tps1_1AdcChannel),
+		CONFIG_RANGE(tps1_2AdcChannel),
+		CONFIG_RANGE(tps2_1AdcChannel),
+		CONFIG_RANGE(tps2_2AdcChannel),
+		CONFIG_RANGE(throttlePedalPositionAdcChannel),
+		CONFIG_RANGE(throttlePedalPositionSecondAdcChannel),
+	}) || isConfigurationChanged(etb_use_two_wires);
+}
+
 void onConfigurationChangeElectronicThrottleCallback(engine_configuration_s *previousConfiguration) {
 	for (int i = 0; i < ETB_COUNT; i++) {
 		etbControllers[i]->onConfigurationChange(&previousConfiguration->etb);
@@ -10,6 +10,7 @@
 #include "closed_loop_controller.h"
 #include "rusefi_types.h"
 #include "engine_configuration.h"
+#include "config_change_tracker.h"
 
 void initElectronicThrottle();
 void doInitElectronicThrottle();
@@ -30,6 +31,7 @@ void setDefaultEtbParameters();
 void setBoschVNH2SP30Curve();
 void setThrottleDutyCycle(percent_t level);
 void onConfigurationChangeElectronicThrottleCallback(engine_configuration_s *previousConfiguration);
+bool isElectronicThrottleConfigurationChanged(ConfigChangeTracker const & changes);
 void unregisterEtbPins();
 void setProteusHitachiEtbDefaults();
 
@@ -48,6 +48,13 @@ void VvtController::onConfigurationChange(engine_configuration_s const * previou
 	}
 }
 
+bool VvtController::isConfigurationChangeRelevant(ConfigChangeTracker const & changes) {
+	// offsetof needs a constant index
+	auto pidRange = CONFIG_RANGE(auxPid[0]);
+	pidRange.offset += m_cam * pidRange.size;
+	return changes.isChanged(pidRange);
+}
+
 expected<angle_t> VvtController::observePlant() {
 #if EFI_SHAFT_POSITION_INPUT
 	return engine->triggerCentral.getVVTPosition(m_bank, m_cam);
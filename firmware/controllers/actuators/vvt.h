@@ -33,6 +33,7 @@ public:
 	// EngineModule implementation
 	void onFastCallback() override;
 	void onConfigurationChange(engine_configuration_s const * previousConfig) override;
+	bool isConfigurationChangeRelevant(ConfigChangeTracker const & changes) override;
 
 	// ClosedLoopController implementation
 	expected<angle_t> observePlant() override;
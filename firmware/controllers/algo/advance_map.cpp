@@ -195,15 +195,16 @@ angle_t getAdvance(int rpm, float engineLoad) {
 #endif
 }
 
-angle_t getCombinedCylinderIgnitionTrim(size_t cylinderNumber, int rpm, float ignitionLoad) {
+angle_t getCombinedCylinderIgnitionTrim(size_t cylinderNumber, Map3DLookupContext& trimLookup) {
     // we have two separate per-cylinder trims, that's a feature
 	// Plus or minus any adjustment if this is an odd-fire engine
 	auto adjustment = engineConfiguration->timing_offset_cylinder[cylinderNumber];
 
-	return adjustment + interpolate3d(
+	// all cylinders share the axes, bins are only searched for the first one
+	return adjustment + interpolate3d(trimLookup,
 		config->ignTrims[cylinderNumber].table,
-		config->ignTrimLoadBins, ignitionLoad,
-		config->ignTrimRpmBins, rpm
+		config->ignTrimLoadBins,
+		config->ignTrimRpmBins
 	);
 }
 
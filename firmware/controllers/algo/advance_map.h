@@ -9,8 +9,11 @@
 
 #pragma once
 
+class Map3DLookupContext;
+
 angle_t getAdvance(int rpm, float engineLoad);
-angle_t getCombinedCylinderIgnitionTrim(size_t cylinderNumber, int rpm, float ignitionLoad);
+// trimLookup is RPM and ignition load
+angle_t getCombinedCylinderIgnitionTrim(size_t cylinderNumber, Map3DLookupContext& trimLookup);
 /**
  * this method is used to build default advance map
  */
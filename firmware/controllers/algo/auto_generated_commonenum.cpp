@@ -121,6 +121,15 @@ case SentEtbType::NONE:
   }
  return NULL;
 }
+const char *getToothLogFormat(ToothLogFormat value){
+switch(value) {
+case ToothLogFormat::Compact:
+  return "Compact";
+case ToothLogFormat::Raw:
+  return "Raw";
+  }
+ return NULL;
+}
 const char *getTransmissionControllerMode(TransmissionControllerMode value){
 switch(value) {
 case TransmissionControllerMode::Gm4l6x:
@@ -24,6 +24,9 @@ const char *getSelectedGear(SelectedGear value);
 const char *getSentEtbType(SentEtbType value);
 #endif //__cplusplus
 #if __cplusplus
+const char *getToothLogFormat(ToothLogFormat value);
+#endif //__cplusplus
+#if __cplusplus
 const char *getTransmissionControllerMode(TransmissionControllerMode value);
 #endif //__cplusplus
 #if __cplusplus
@@ -0,0 +1,75 @@
+/**
+ * @file config_change_tracker.cpp
+ */
+
+#include "pch.h"
+
+#include "config_change_tracker.h"
+
+void ConfigChangeTracker::update(const engine_configuration_s& previous, const engine_configuration_s& current) {
+	memset(m_isChanged, 0, sizeof(m_isChanged));
+
+	auto previousBytes = reinterpret_cast<const uint8_t*>(&previous);
+	auto currentBytes = reinterpret_cast<const uint8_t*>(&current);
+
+	for (size_t block = 0; block < blockCount; block++) {
+		size_t offset = block * CONFIG_CHANGE_BLOCK_SIZE;
+		size_t size = std::min<size_t>(CONFIG_CHANGE_BLOCK_SIZE, sizeof(engine_configuration_s) - offset);
+
+		if (memcmp(previousBytes + offset, currentBytes + offset, size) != 0) {
+			m_isChanged[block / 32] |= 1U << (block % 32);
+		}
+	}
+}
+
+void ConfigChangeTracker::setAllChanged() {
+	memset(m_isChanged, 0, sizeof(m_isChanged));
+	for (size_t block = 0; block < blockCount; block++) {
+		m_isChanged[block / 32] |= 1U << (block % 32);
+	}
+}
+
+bool ConfigChangeTracker::isChanged(ConfigRange range) const {
+	if (range.size == 0) {
+		return false;
+	}
+
+	size_t lastBlock = (range.offset + range.size - 1) / CONFIG_CHANGE_BLOCK_SIZE;
+	for (size_t block = range.offset / CONFIG_CHANGE_BLOCK_SIZE; block <= lastBlock && block < blockCount; block++) {
+		if (m_isChanged[block / 32] & (1U << (block % 32))) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool ConfigChangeTracker::isChanged(std::initializer_list<ConfigRange> ranges) const {
+	for (auto range : ranges) {
+		if (isChanged(range)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool ConfigChangeTracker::isAnyChanged() const {
+	for (size_t i = 0; i < efi::size(m_isChanged); i++) {
+		if (m_isChanged[i]) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+size_t ConfigChangeTracker::getChangedBlockCount() const {
+	size_t count = 0;
+	for (size_t block = 0; block < blockCount; block++) {
+		if (m_isChanged[block / 32] & (1U << (block % 32))) {
+			count++;
+		}
+	}
+	return count;
+}
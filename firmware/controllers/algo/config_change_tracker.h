@@ -0,0 +1,50 @@
+/**
+ * @file config_change_tracker.h
+ *
+ * Which parts of engine_configuration_s have changed since activeConfiguration, computed once per
+ * incrementGlobalConfigurationVersion so that consumers with expensive re-initialization
+ * can skip it when none of the fields they depend on were touched.
+ *
+ * Only engine_configuration_s is compared: tables in persistent_config_s are not part of activeConfiguration.
+ * Bit fields have no address, use isConfigurationChanged for those.
+ */
+
+#pragma once
+
+#include "engine_configuration_generated_structures.h"
+
+#include <initializer_list>
+
+// granularity of the change bitmap, a change anywhere in the block marks the whole block as changed
+#define CONFIG_CHANGE_BLOCK_SIZE 4
+
+struct ConfigRange {
+	uint16_t offset;
+	uint16_t size;
+};
+
+#define CONFIG_RANGE(field) ConfigRange{ \
+	static_cast<uint16_t>(offsetof(engine_configuration_s, field)), \
+	static_cast<uint16_t>(sizeof(static_cast<engine_configuration_s*>(nullptr)->field)) }
+
+class ConfigChangeTracker {
+public:
+	void update(const engine_configuration_s& previous, const engine_configuration_s& current);
+	// nothing to compare against, for example the very first configuration
+	void setAllChanged();
+
+	bool isChanged(ConfigRange range) const;
+	bool isChanged(std::initializer_list<ConfigRange> ranges) const;
+	bool isAnyChanged() const;
+
+	size_t getChangedBlockCount() const;
+
+private:
+	static constexpr size_t blockCount = (sizeof(engine_configuration_s) + CONFIG_CHANGE_BLOCK_SIZE - 1) / CONFIG_CHANGE_BLOCK_SIZE;
+
+	uint32_t m_isChanged[(blockCount + 31) / 32] = {};
+};
+
+static_assert(sizeof(engine_configuration_s) <= UINT16_MAX, "ConfigRange offset");
+
+const ConfigChangeTracker& getConfigChanges();
@@ -166,18 +166,23 @@ void EngineState::periodicFastCallback() {
 		engine->stftCorrection[i] = corr;
 	}
 
+	Map3DLookupContext fuelTrimLookup(rpm, fuelLoad);
+	Map3DLookupContext ignitionTrimLookup(rpm, ignitionLoad);
+
 	// Now apply that to per-cylinder fueling and timing
 	for (size_t i = 0; i < engineConfiguration->cylindersCount; i++) {
 		uint8_t bankIndex = engineConfiguration->cylinderBankSelect[i];
 		auto bankTrim = engine->stftCorrection[bankIndex];
-		auto cylinderTrim = getCylinderFuelTrim(i, rpm, fuelLoad);
+		auto cylinderTrim = getCylinderFuelTrim(i, fuelTrimLookup);
 
 		// Apply both per-bank and per-cylinder trims
 		engine->engineState.injectionMass[i] = injectionMass * bankTrim * cylinderTrim;
 
-		timingAdvance[i] = correctedIgnitionAdvance + getCombinedCylinderIgnitionTrim(i, rpm, ignitionLoad);
+		timingAdvance[i] = correctedIgnitionAdvance + getCombinedCylinderIgnitionTrim(i, ignitionTrimLookup);
 	}
 
+	updateFuelPlan();
+
 	shouldUpdateInjectionTiming = getInjectorDutyCycle(rpm) < 90;
 
 	// TODO: calculate me from a table!
@@ -195,6 +200,34 @@ void EngineState::periodicFastCallback() {
 #endif // EFI_SHAFT_POSITION_INPUT
 }
 
+void EngineState::updateFuelPlan() {
+#if EFI_ENGINE_CONTROL
+	FuelPlan plan;
+
+	bool isCranking = engine->rpmCalculator.isCranking();
+	plan.numberOfInjections = getNumberOfInjections(isCranking ? engineConfiguration->crankingInjectionMode : engineConfiguration->injectionMode);
+
+	auto injectorModel = engine->module<InjectorModel>();
+	float gramsPerMs = injectorModel->getFuelMassForDuration(1);
+
+	if (engineConfiguration->injectorNonlinearMode == INJ_None && gramsPerMs > 0) {
+		plan.isLinear = true;
+		plan.msPerGram = 1 / gramsPerMs;
+		// one millisecond worth of fuel takes one millisecond plus deadtime
+		plan.deadtime = injectorModel->getInjectionDuration(gramsPerMs) - 1;
+	}
+
+	for (size_t i = 0; i < engineConfiguration->cylindersCount; i++) {
+		float massGrams = injectionMass[i];
+		plan.cylinders[i].massGrams = massGrams;
+		plan.cylinders[i].duration = injectorModel->getInjectionDuration(massGrams);
+	}
+
+	chibios_rt::CriticalSectionLocker csl;
+	fuelPlan = plan;
+#endif // EFI_ENGINE_CONTROL
+}
+
 void EngineState::updateTChargeK(int rpm, float tps) {
 #if EFI_ENGINE_CONTROL
 	float newTCharge = engine->fuelComputer.getTCharge(rpm, tps);
@@ -26,6 +26,7 @@
 #include "speed_density.h"
 #include "advance_map.h"
 #include "flash_main.h"
+#include "config_change_tracker.h"
 
 #include "bench_test.h"
 
@@ -133,6 +134,12 @@ static engine_configuration_s activeConfigurationLocalStorage;
 engine_configuration_s & activeConfiguration = activeConfigurationLocalStorage;
 #endif /* EFI_ACTIVE_CONFIGURATION_IN_FLASH */
 
+static ConfigChangeTracker configChanges;
+
+const ConfigChangeTracker& getConfigChanges() {
+	return configChanges;
+}
+
 void rememberCurrentConfiguration() {
 #if ! EFI_ACTIVE_CONFIGURATION_IN_FLASH
 	memcpy(&activeConfiguration, engineConfiguration, sizeof(engine_configuration_s));
@@ -181,6 +188,15 @@ void incrementGlobalConfigurationVersion(const char * msg) {
 	efiPrintf("set globalConfigurationVersion=%d", globalConfigurationVersion);
 #endif /* EFI_DEFAILED_LOGGING */
 
+#if EFI_ACTIVE_CONFIGURATION_IN_FLASH
+	if (isActiveConfigurationVoid) {
+		configChanges.setAllChanged();
+	} else
+#endif /* EFI_ACTIVE_CONFIGURATION_IN_FLASH */
+	{
+		configChanges.update(activeConfiguration, *engineConfiguration);
+	}
+
 	applyNewHardwareSettings();
 
 	boardOnConfigurationChange(&activeConfiguration);
@@ -191,7 +207,10 @@ void incrementGlobalConfigurationVersion(const char * msg) {
 #endif /* EFI_ALTERNATOR_CONTROL */
 
 #if EFI_ELECTRONIC_THROTTLE_BODY
-	onConfigurationChangeElectronicThrottleCallback(&activeConfiguration);
+	// re-initializing DC motors is expensive, most burns are about something else
+	if (isElectronicThrottleConfigurationChanged(configChanges)) {
+		onConfigurationChangeElectronicThrottleCallback(&activeConfiguration);
+	}
 #endif /* EFI_ELECTRONIC_THROTTLE_BODY */
 
 #if EFI_ENGINE_CONTROL && EFI_PROD_CODE
@@ -199,14 +218,19 @@ void incrementGlobalConfigurationVersion(const char * msg) {
 #endif
 
 #if EFI_SHAFT_POSITION_INPUT
-	onConfigurationChangeTriggerCallback();
+	// trigger fields are all in engine_configuration_s
+	if (configChanges.isAnyChanged()) {
+		onConfigurationChangeTriggerCallback();
+	}
 #endif /* EFI_SHAFT_POSITION_INPUT */
 #if EFI_EMULATE_POSITION_SENSORS && ! EFI_UNIT_TEST
 	onConfigurationChangeRpmEmulatorCallback(&activeConfiguration);
 #endif /* EFI_EMULATE_POSITION_SENSORS */
 
 	engine->engineModules.apply_all([](auto & m) {
-			m.onConfigurationChange(&activeConfiguration);
+			if (m.isConfigurationChangeRelevant(configChanges)) {
+				m.onConfigurationChange(&activeConfiguration);
+			}
 		});
 	rememberCurrentConfiguration();
 }
@@ -432,6 +456,7 @@ static void setDefaultEngineConfiguration() {
 	engineConfiguration->verboseCanBaseAddress = CAN_DEFAULT_BASE;
 
 	engineConfiguration->sdCardLogFrequency = 50;
+	engineConfiguration->sdCardLogSlowDivider = 1;
 
 	engineConfiguration->mapMinBufferLength = 1;
 	engineConfiguration->vvtActivationDelayMs = 6000;
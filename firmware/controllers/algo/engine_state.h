@@ -18,6 +18,7 @@ public:
 	void periodicFastCallback();
 	void updateSlowSensors();
 	void updateTChargeK(int rpm, float tps);
+	void updateFuelPlan();
 
 	/**
 	 * always 360 or 720, never zero
@@ -32,6 +33,50 @@ public:
 	// Per-injection fuel mass, including TPS accel enrich
 	float injectionMass[MAX_CYLINDER_COUNT] = {0};
 
+	/**
+	 * Injector model resolved once per fast callback so that trigger callback does not have to run it
+	 * for whatever mass wall wetting gives it.
+	 * Linear injector is 'mass * msPerGram + deadtime' for any mass, nonlinear small pulse correction
+	 * is only known at the planned mass of each cylinder.
+	 */
+	struct FuelPlan {
+		struct {
+			float massGrams = 0;
+			floatms_t duration = 0;
+		} cylinders[MAX_CYLINDER_COUNT];
+
+		bool isLinear = false;
+		float msPerGram = 0;
+		floatms_t deadtime = 0;
+
+		// Injections per engine cycle for current cranking/running injection mode
+		int numberOfInjections = 1;
+
+		/**
+		 * @return false if duration for this mass has to come from injector model
+		 */
+		bool getInjectionDuration(size_t cylinderIndex, float fuelMassGram, floatms_t& duration) const {
+			auto& cylinder = cylinders[cylinderIndex];
+			if (fuelMassGram == cylinder.massGrams) {
+				duration = cylinder.duration;
+				return true;
+			}
+
+			if (!isLinear) {
+				return false;
+			}
+
+			// same as injector model: no fuel means no injection
+			duration = fuelMassGram <= 0 ? 0 : fuelMassGram * msPerGram + deadtime;
+			return true;
+		}
+	};
+
+	/**
+	 * Only replaced as a whole under lock, trigger callback never sees half of an update
+	 */
+	FuelPlan fuelPlan;
+
 	Timer crankingTimer;
 
 	WarningCodeState warnings;
@@ -43,7 +88,7 @@ public:
 	float auxValveEnd = 0;
 
 	/**
-	 * MAP averaging angle start, in relation to 'mapAveragingSchedulingAtIndex' trigger index index
+	 * MAP averaging angle start, engine phase same as TriggerScheduler events
 	 */
 	angle_t mapAveragingStart[MAX_CYLINDER_COUNT];
 	angle_t mapAveragingDuration = 0;
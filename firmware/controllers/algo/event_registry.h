@@ -12,6 +12,7 @@
 #include "scheduler.h"
 #include "fl_stack.h"
 #include "trigger_structure.h"
+#include "phase_buckets.h"
 
 struct AngleBasedEvent {
 	scheduling_s scheduling;
@@ -20,6 +21,10 @@ struct AngleBasedEvent {
 	 * Trigger-based scheduler maintains a linked list of all pending tooth-based events.
 	 */
 	AngleBasedEvent *nextToothEvent = nullptr;
+	/**
+	 * Index of TriggerScheduler bucket this event is queued in, -1 if not queued
+	 */
+	int8_t phaseBucket = -1;
 
 	angle_t enginePhase;
 
@@ -82,6 +87,10 @@ public:
 	 * ignition events, per cylinder
 	 */
 	IgnitionEvent elements[MAX_CYLINDER_COUNT];
+	/**
+	 * dwell start angles by phase bucket, so that each tooth only looks at cylinders due soon
+	 */
+	PhaseDispatchTable dwellDispatch;
 	bool isReady = false;
 };
 
@@ -431,11 +431,12 @@ float getStandardAirCharge() {
 	return idealGasLaw(cylDisplacement, 101.325f, 273.15f + 20.0f);
 }
 
-float getCylinderFuelTrim(size_t cylinderNumber, int rpm, float fuelLoad) {
-	auto trimPercent = interpolate3d(
+float getCylinderFuelTrim(size_t cylinderNumber, Map3DLookupContext& trimLookup) {
+	// all cylinders share the axes, bins are only searched for the first one
+	auto trimPercent = interpolate3d(trimLookup,
 		config->fuelTrims[cylinderNumber].table,
-		config->fuelTrimLoadBins, fuelLoad,
-		config->fuelTrimRpmBins, rpm
+		config->fuelTrimLoadBins,
+		config->fuelTrimRpmBins
 	);
 
 	// Convert from percent +- to multiplier
@@ -9,6 +9,8 @@
 
 #include "rusefi_types.h"
 
+class Map3DLookupContext;
+
 void initFuelMap();
 
 /**
@@ -30,7 +32,8 @@ float getInjectionMass(int rpm);
 percent_t getInjectorDutyCycle(int rpm);
 
 float getStandardAirCharge();
-float getCylinderFuelTrim(size_t cylinderNumber, int rpm, float fuelLoad);
+// trimLookup is RPM and fuel load
+float getCylinderFuelTrim(size_t cylinderNumber, Map3DLookupContext& trimLookup);
 
 struct AirmassModelBase;
 AirmassModelBase* getAirmassModel(engine_load_mode_e mode);
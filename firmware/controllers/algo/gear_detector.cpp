@@ -55,6 +55,10 @@ void GearDetector::onConfigurationChange(engine_configuration_s const * /*previo
     initGearDetector();
 }
 
+bool GearDetector::isConfigurationChangeRelevant(ConfigChangeTracker const & changes) {
+	return changes.isChanged({ CONFIG_RANGE(totalGearsCount), CONFIG_RANGE(gearRatio) });
+}
+
 void GearDetector::onSlowCallback() {
     if (!isInitialized) {
         initGearDetector();
@@ -7,6 +7,7 @@ public:
 
 	void onSlowCallback() override;
 	void onConfigurationChange(engine_configuration_s const * /*previousConfig*/) override;
+	bool isConfigurationChangeRelevant(ConfigChangeTracker const & changes) override;
 
 	float getGearboxRatio() const;
 
@@ -187,6 +187,11 @@ enum class UiMode : uint8_t {
 	TUNING = 2,
 };
 
+enum class ToothLogFormat : uint8_t {
+	Raw = 0,
+	Compact = 1,
+};
+
 typedef enum __attribute__ ((__packed__)) {
 	/**
 	 * GND for logical OFF, VCC for logical ON
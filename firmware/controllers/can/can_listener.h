@@ -42,11 +42,21 @@ public:
 		return CAN_ID(frame) == m_id;
 	}
 
+	// Return false if acceptFrame may accept IDs other than getId(), such listeners are
+	// offered every frame instead of only frames with their own ID, see CanListenerDispatch
+	virtual bool acceptsOnlyOwnId() const {
+		return true;
+	}
+
 protected:
 	virtual void decodeFrame(const CANRxFrame& frame, efitick_t nowNt) = 0;
 
 private:
+	friend class CanListenerDispatch;
+
 	CanListener* m_next = nullptr;
+	// next listener in the same CanListenerDispatch bucket
+	CanListener* m_nextInBucket = nullptr;
 
 	const uint32_t m_id;
 };
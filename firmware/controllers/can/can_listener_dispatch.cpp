@@ -0,0 +1,29 @@
+/**
+ * @file	can_listener_dispatch.cpp
+ */
+
+#include "pch.h"
+
+#include "can_listener_dispatch.h"
+
+size_t CanListenerDispatch::getBucket(uint32_t id) {
+	// Fibonacci hashing: top bits of multiplicative hash
+	return (id * 2654435761u) >> (32 - CAN_LISTENER_BUCKET_BITS);
+}
+
+void CanListenerDispatch::add(CanListener& listener) {
+	// prepend just like the registration list so that listeners sharing an ID keep their relative order
+	CanListener** head = listener.acceptsOnlyOwnId() ? &m_buckets[getBucket(listener.getId())] : &m_anyId;
+	listener.m_nextInBucket = *head;
+	*head = &listener;
+}
+
+void CanListenerDispatch::dispatch(const CANRxFrame& frame, efitick_t nowNt) const {
+	for (CanListener* current = m_buckets[getBucket(CAN_ID(frame))]; current; current = current->m_nextInBucket) {
+		current->processFrame(frame, nowNt);
+	}
+
+	for (CanListener* current = m_anyId; current; current = current->m_nextInBucket) {
+		current->processFrame(frame, nowNt);
+	}
+}
@@ -0,0 +1,31 @@
+/**
+ * @file	can_listener_dispatch.h
+ *
+ * Hands incoming frames to CAN listeners without asking every registered listener about every frame.
+ */
+
+#pragma once
+
+#include "can_listener.h"
+
+#define CAN_LISTENER_BUCKET_BITS 5
+
+/**
+ * Listeners which only accept their own ID are chained into buckets by ID hash at registration time,
+ * a frame only visits the bucket of its ID. Listeners with custom acceptFrame logic are offered every frame.
+ * acceptFrame is still consulted for each candidate, so hash collisions and IDE/DLC checks behave as before.
+ */
+class CanListenerDispatch {
+public:
+	void add(CanListener& listener);
+	void dispatch(const CANRxFrame& frame, efitick_t nowNt) const;
+
+private:
+	static constexpr size_t bucketCount = 1 << CAN_LISTENER_BUCKET_BITS;
+
+	static size_t getBucket(uint32_t id);
+
+	CanListener* m_buckets[bucketCount] = {};
+	// listeners which want to look at all IDs
+	CanListener* m_anyId = nullptr;
+};
@@ -13,6 +13,7 @@
 #include "rusefi_lua.h"
 #include "can_bench_test.h"
 #include "can_common.h"
+#include "can_listener_dispatch.h"
 
 // todo: consume from fresh wideband_can.h https://github.com/rusefi/rusefi/issues/5208
 #define WB_ACK 0x727573
@@ -56,19 +57,20 @@ static void printPacket(const size_t busIndex, const CANRxFrame &rx) {
 
 volatile float canMap = 0;
 
+// all listeners, CAN TX walks this list
 CanListener *canListeners_head = nullptr;
 
-void serviceCanSubscribers(const CANRxFrame &frame, efitick_t nowNt) {
-	CanListener *current = canListeners_head;
+// same listeners indexed by ID for RX
+static CanListenerDispatch canListenerDispatch;
 
-	while (current) {
-		current = current->processFrame(frame, nowNt);
-	}
+void serviceCanSubscribers(const CANRxFrame &frame, efitick_t nowNt) {
+	canListenerDispatch.dispatch(frame, nowNt);
 }
 
 void registerCanListener(CanListener& listener) {
 	listener.setNext(canListeners_head);
 	canListeners_head = &listener;
+	canListenerDispatch.add(listener);
 }
 
 void registerCanSensor(CanSensorBase& sensor) {
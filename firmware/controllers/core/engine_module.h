@@ -5,12 +5,16 @@
 #pragma once
 
 #include "engine_configuration.h"
+#include "config_change_tracker.h"
 
 class EngineModule {
 public:
 	// Called when 'Burn' is invoked
 	virtual void onConfigurationChange(engine_configuration_s const * /*previousConfig*/) { }
 
+	// Queried before onConfigurationChange, override to skip it when none of the fields it depends on have changed
+	virtual bool isConfigurationChangeRelevant(ConfigChangeTracker const & /*changes*/) { return true; }
+
 	// Called approx 20Hz
 	virtual void onSlowCallback() { }
 
@@ -24,11 +24,17 @@ static void plainPinTurnOff(NamedOutputPin *output) {
 }
 
 
+static angle_t getOpenAngle(AuxActor *current) {
+	angle_t openAngle = current->extra + engine->engineState.auxValveStart;
+	wrapAngle(openAngle, "aux-open", ObdCode::CUSTOM_ERR_6557);
+	return openAngle;
+}
+
 static void scheduleOpen(AuxActor *current) {
-	engine->module<TriggerScheduler>()->schedule(
+	engine->module<TriggerScheduler>()->scheduleOrQueue(
 			"aux-valve",
 			&current->open,
-			current->extra + engine->engineState.auxValveStart,
+			getOpenAngle(current),
 			{ auxPlainPinTurnOn, current }
 			);
 }
@@ -37,16 +43,26 @@ void auxPlainPinTurnOn(AuxActor *current) {
 	NamedOutputPin *output = &enginePins.auxValve[current->valveIndex];
 	output->setHigh();
 
-	scheduleOpen(current);
+	// we are at open angle right now, scheduleOrQueue would fire it again right away instead of next cycle
+	engine->module<TriggerScheduler>()->schedule(
+			"aux-valve",
+			&current->open,
+			getOpenAngle(current),
+			{ auxPlainPinTurnOn, current }
+			);
 
 	angle_t duration = engine->engineState.auxValveEnd - engine->engineState.auxValveStart;
 
 	wrapAngle(duration, "duration", ObdCode::CUSTOM_ERR_6557);
 
-	engine->module<TriggerScheduler>()->schedule(
+	angle_t closeAngle = current->extra + engine->engineState.auxValveEnd;
+	wrapAngle(closeAngle, "aux-close", ObdCode::CUSTOM_ERR_6557);
+
+	// close angle within current tooth window is scheduled right away instead of waiting a whole cycle in the queue
+	engine->module<TriggerScheduler>()->scheduleOrQueue(
 			"aux-valve",
 			&current->close,
-			current->extra + engine->engineState.auxValveEnd,
+			closeAngle,
 			{ plainPinTurnOff, output }
 			);
 	}
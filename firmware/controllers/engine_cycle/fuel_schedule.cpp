@@ -136,6 +136,8 @@ bool FuelSchedule::addFuelEventsForCylinder(int i) {
 		return false;
 	}
 
+	injectionDispatch.setPhase(i, ev->injectionStartAngle);
+
 	injection_mode_e mode = getCurrentInjectionMode();
 	engine->outputChannels.currentInjectionMode = static_cast<uint8_t>(mode);
 
@@ -204,7 +206,14 @@ void FuelSchedule::onTriggerTooth(int rpm, efitick_t nowNt, float currentPhase,
 		return;
 	}
 
-	for (size_t i = 0; i < engineConfiguration->cylindersCount; i++) {
+	// only cylinders with injection start anywhere near this tooth
+	uint32_t candidates = injectionDispatch.getCandidates(currentPhase, nextPhase)
+		& ((1U << engineConfiguration->cylindersCount) - 1);
+
+	while (candidates) {
+		size_t i = __builtin_ctz(candidates);
+		candidates &= candidates - 1;
+
 		elements[i].onTriggerTooth(rpm, nowNt, currentPhase, nextPhase);
 	}
 }
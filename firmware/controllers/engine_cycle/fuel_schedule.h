@@ -10,6 +10,7 @@
 #include "fl_stack.h"
 #include "trigger_structure.h"
 #include "wall_fuel.h"
+#include "phase_buckets.h"
 
 #define MAX_WIRES_COUNT 2
 
@@ -90,6 +91,10 @@ public:
 	 * injection events, per cylinder
 	 */
 	InjectionEvent elements[MAX_CYLINDER_COUNT];
+	/**
+	 * injection start angles by phase bucket, so that each tooth only looks at cylinders due soon
+	 */
+	PhaseDispatchTable injectionDispatch;
 	bool isReady = false;
 };
 
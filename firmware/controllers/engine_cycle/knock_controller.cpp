@@ -52,6 +52,10 @@ int getCylinderKnockBank(uint8_t cylinderNumber) {
 }
 
 bool KnockControllerBase::onKnockSenseCompleted(uint8_t cylinderNumber, float dbv, efitick_t lastKnockTime) {
+	if (cylinderNumber >= efi::size(peakDetectors)) {
+		return false;
+	}
+
 	bool isKnock = dbv > m_knockThreshold;
 
 	// Per-cylinder peak detector
@@ -84,6 +88,32 @@ bool KnockControllerBase::onKnockSenseCompleted(uint8_t cylinderNumber, float db
 	return isKnock;
 }
 
+bool KnockControllerBase::onKnockSenseCompleted(uint8_t cylinderNumber, const float *bandDb, size_t bandCount, efitick_t lastKnockTime) {
+	if (cylinderNumber >= efi::size(m_knockBandDb)) {
+		return false;
+	}
+
+	float loudest = -100;
+
+	for (size_t i = 0; i < bandCount && i < KNOCK_SPECTRUM_BANDS; i++) {
+		m_knockBandDb[cylinderNumber][i] = bandDb[i];
+		loudest = maxF(loudest, bandDb[i]);
+
+		// All-cylinders per-band peak detector
+		m_knockBand[i] = roundf(bandPeakDetectors[i].detect(bandDb[i], lastKnockTime));
+	}
+
+	return onKnockSenseCompleted(cylinderNumber, loudest, lastKnockTime);
+}
+
+float KnockControllerBase::getKnockBandLevel(uint8_t cylinderNumber, size_t band) const {
+	if (cylinderNumber >= efi::size(m_knockBandDb) || band >= KNOCK_SPECTRUM_BANDS) {
+		return 0;
+	}
+
+	return m_knockBandDb[cylinderNumber][band];
+}
+
 float KnockControllerBase::getKnockRetard() const {
 	return m_knockRetard;
 }
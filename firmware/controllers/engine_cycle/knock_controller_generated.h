@@ -38,8 +38,19 @@ struct knock_controller_s {
 	 * offset 28
 	 */
 	float m_maximumRetard = (float)0;
+	/**
+	 * Knock: Dropped windows
+	 * offset 32
+	 */
+	uint32_t m_knockDroppedWindows = (uint32_t)0;
+	/**
+	 * Knock: Band
+	dBv
+	 * offset 36
+	 */
+	int8_t m_knockBand[4];
 };
-static_assert(sizeof(knock_controller_s) == 32);
+static_assert(sizeof(knock_controller_s) == 40);
 
 // end
 // this section was generated automatically by rusEFI tool config_definition_base.jar based on (unknown script) controllers/engine_cycle/knock_controller.txt Tue Sep 26 02:21:02 UTC 2023
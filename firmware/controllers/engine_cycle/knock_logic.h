@@ -23,6 +23,15 @@ public:
 
 	// onKnockSenseCompleted is the callback from the knock sense driver to report a sensed knock level
 	bool onKnockSenseCompleted(uint8_t cylinderNumber, float dbv, efitick_t lastKnockTime);
+	// Multi-band variant: every band level is kept per cylinder, knock is judged on the loudest band
+	bool onKnockSenseCompleted(uint8_t cylinderNumber, const float *bandDb, size_t bandCount, efitick_t lastKnockTime);
+
+	float getKnockBandLevel(uint8_t cylinderNumber, size_t band) const;
+
+	// knock sense driver could not sample a cylinder's window
+	void onKnockSenseDropped() {
+		m_knockDroppedWindows++;
+	}
 
 	float getKnockRetard() const;
 	uint32_t getKnockCount() const;
@@ -34,6 +43,9 @@ private:
 	using PD = PeakDetect<float, MS2NT(50)>;
 	PD peakDetectors[12];
 	PD allCylinderPeakDetector;
+	PD bandPeakDetectors[KNOCK_SPECTRUM_BANDS];
+
+	float m_knockBandDb[12][KNOCK_SPECTRUM_BANDS] = {};
 };
 
 class KnockController : public KnockControllerBase {
@@ -80,7 +80,14 @@ void InjectionEvent::onTriggerTooth(int rpm, efitick_t nowNt, float currentPhase
 	// Perform wall wetting adjustment on fuel mass, not duration, so that
 	// it's correct during fuel pressure (injector flow) or battery voltage (deadtime) transients
 	injectionMassGrams = wallFuel.adjust(injectionMassGrams);
-	const floatms_t injectionDuration = engine->module<InjectorModel>()->getInjectionDuration(injectionMassGrams);
+
+	// trigger callback is never interrupted by fast callback publishing a new plan
+	const auto& plan = getEngineState()->fuelPlan;
+	floatms_t injectionDuration;
+	if (!plan.getInjectionDuration(this->cylinderNumber, injectionMassGrams, injectionDuration)) {
+		// wall wetting changed the mass of a nonlinear injector, correction has to be evaluated at the actual mass
+		injectionDuration = engine->module<InjectorModel>()->getInjectionDuration(injectionMassGrams);
+	}
 
 #if EFI_PRINTF_FUEL_DETAILS
 	if (printFuelDebug) {
@@ -90,12 +97,7 @@ void InjectionEvent::onTriggerTooth(int rpm, efitick_t nowNt, float currentPhase
 	}
 #endif /*EFI_PRINTF_FUEL_DETAILS */
 
-	bool isCranking = getEngineRotationState()->isCranking();
-	/**
-	 * todo: pre-calculate 'numberOfInjections'
-	 * see also injectorDutyCycle
-	 */
-	int numberOfInjections = isCranking ? getNumberOfInjections(engineConfiguration->crankingInjectionMode) : getNumberOfInjections(engineConfiguration->injectionMode);
+	int numberOfInjections = plan.numberOfInjections;
 	if (injectionDuration * numberOfInjections > getEngineCycleDuration(rpm)) {
 		warning(ObdCode::CUSTOM_TOO_LONG_FUEL_INJECTION, "Too long fuel injection %.2fms", injectionDuration);
 	}
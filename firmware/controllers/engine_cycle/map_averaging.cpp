@@ -54,14 +54,14 @@ static int averagedMapBufIdx = 0;
 /**
  * here we have averaging start and averaging end points for each cylinder
  */
-static scheduling_s startTimers[MAX_CYLINDER_COUNT][2];
-static scheduling_s endTimers[MAX_CYLINDER_COUNT][2];
+static AngleBasedEvent startEvents[MAX_CYLINDER_COUNT][2];
+static AngleBasedEvent endEvents[MAX_CYLINDER_COUNT][2];
 
 static void endAveraging(MapAverager* arg);
 
 static size_t currentMapAverager = 0;
 
-static void startAveraging(scheduling_s *endAveragingScheduling) {
+static void startAveraging(AngleBasedEvent *endEvent) {
 	efiAssertVoid(ObdCode::CUSTOM_ERR_6649, hasLotsOfRemainingStack(), "lowstck#9");
 
 	// TODO: set currentMapAverager based on cylinder bank
@@ -70,7 +70,8 @@ static void startAveraging(scheduling_s *endAveragingScheduling) {
 
 	mapAveragingPin.setHigh();
 
-	scheduleByAngle(endAveragingScheduling, getTimeNowNt(), engine->engineState.mapAveragingDuration,
+	// end angle was set by mapAveragingTriggerCallback
+	engine->module<TriggerScheduler>()->scheduleOrQueue("map-end", endEvent, endEvent->enginePhase,
 		{ endAveraging, &averager });
 }
 
@@ -175,16 +176,13 @@ void refreshMapAveragingPreCalc() {
 		angle_t start = interpolate2d(rpm, c->samplingAngleBins, c->samplingAngle);
 		efiAssertVoid(ObdCode::CUSTOM_ERR_MAP_START_ASSERT, !cisnan(start), "start");
 
-		angle_t offsetAngle = engine->triggerCentral.triggerFormDetails.eventAngles[engineConfiguration->mapAveragingSchedulingAtIndex];
-		efiAssertVoid(ObdCode::CUSTOM_ERR_MAP_AVG_OFFSET, !cisnan(offsetAngle), "offsetAngle");
-
 		for (size_t i = 0; i < engineConfiguration->cylindersCount; i++) {
 			angle_t cylinderOffset = getEngineCycle(getEngineRotationState()->getOperationMode()) * i / engineConfiguration->cylindersCount;
 			efiAssertVoid(ObdCode::CUSTOM_ERR_MAP_CYL_OFFSET, !cisnan(cylinderOffset), "cylinderOffset");
 			// part of this formula related to specific cylinder offset is never changing - we can
 			// move the loop into start-up calculation and not have this loop as part of periodic calculation
 			// todo: change the logic as described above in order to reduce periodic CPU usage?
-			float cylinderStart = start + cylinderOffset - offsetAngle + tdcPosition();
+			float cylinderStart = start + cylinderOffset;
 			wrapAngle(cylinderStart, "cylinderStart", ObdCode::CUSTOM_ERR_6562);
 			engine->engineState.mapAveragingStart[i] = cylinderStart;
 		}
@@ -198,16 +196,7 @@ void refreshMapAveragingPreCalc() {
 
 }
 
-/**
- * Shaft Position callback used to schedule start and end of MAP averaging
- */
-void mapAveragingTriggerCallback(
-		uint32_t index, efitick_t edgeTimestamp) {
-#if EFI_ENGINE_CONTROL && EFI_PROD_CODE
-	// this callback is invoked on interrupt thread
-	if (index != (uint32_t)engineConfiguration->mapAveragingSchedulingAtIndex)
-		return;
-
+void scheduleMapAveraging(efitick_t edgeTimestamp, float currentPhase, float nextPhase) {
 	int rpm = Sensor::getOrZero(SensorType::Rpm);
 	if (!isValidRpm(rpm)) {
 		return;
@@ -246,15 +235,28 @@ void mapAveragingTriggerCallback(
 		// only if value is already prepared
 		int structIndex = getRevolutionCounter() % 2;
 
-		scheduling_s *startTimer = &startTimers[i][structIndex];
-		scheduling_s *endTimer = &endTimers[i][structIndex];
+		AngleBasedEvent *startEvent = &startEvents[i][structIndex];
+		AngleBasedEvent *endEvent = &endEvents[i][structIndex];
+		endEvent->setAngle(samplingEnd);
 
-		// at the moment we schedule based on time prediction based on current RPM and angle
-		// we are loosing precision in case of changing RPM - the further away is the event the worse is precision
-		// todo: schedule this based on closest trigger event, same as ignition works
-		scheduleByAngle(startTimer, edgeTimestamp, samplingStart,
-				{ startAveraging, endTimer });
+		// both start and end wait in TriggerScheduler for the tooth right before them so that
+		// only a fraction of tooth is converted to time, same as ignition works
+		engine->module<TriggerScheduler>()->scheduleOrQueue("map-start", startEvent, edgeTimestamp, samplingStart,
+				{ startAveraging, endEvent }, currentPhase, nextPhase);
 	}
+}
+
+/**
+ * Shaft Position callback used to schedule start and end of MAP averaging
+ */
+void mapAveragingTriggerCallback(
+		uint32_t index, efitick_t edgeTimestamp, float currentPhase, float nextPhase) {
+#if EFI_ENGINE_CONTROL && EFI_PROD_CODE
+	// this callback is invoked on interrupt thread
+	if (index != (uint32_t)engineConfiguration->mapAveragingSchedulingAtIndex)
+		return;
+
+	scheduleMapAveraging(edgeTimestamp, currentPhase, nextPhase);
 #endif // EFI_ENGINE_CONTROL && EFI_PROD_CODE
 }
 
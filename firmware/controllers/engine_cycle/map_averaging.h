@@ -19,7 +19,13 @@ void initMapAveraging();
 void refreshMapAveragingPreCalc();
 
 void mapAveragingTriggerCallback(
-		uint32_t index, efitick_t edgeTimestamp);
+		uint32_t index, efitick_t edgeTimestamp, float currentPhase, float nextPhase);
+
+/**
+ * Schedules start and end of averaging for each sampled cylinder, invoked once per engine cycle by the
+ * trigger callback. Tooth at 'edgeTimestamp' covers [currentPhase, nextPhase) of engine cycle.
+ */
+void scheduleMapAveraging(efitick_t edgeTimestamp, float currentPhase, float nextPhase);
 
 #if EFI_TUNER_STUDIO
 void postMapState(TunerStudioOutputChannels *tsOutputChannels);
@@ -389,7 +389,14 @@ void tdcMarkCallback(
  */
 efitick_t scheduleByAngle(scheduling_s *timer, efitick_t edgeTimestamp, angle_t angle,
 		action_s action) {
-	float delayUs = engine->rpmCalculator.oneDegreeUs * angle;
+	float delayUs = NAN;
+	if (engine->rpmCalculator.predictiveAngleScheduling) {
+		// cached RPM is fine at steady state, under acceleration the further away is the event the worse it gets
+		delayUs = engine->triggerCentral.instantRpm.getAngleToTimeUs(angle, edgeTimestamp);
+	}
+	if (cisnan(delayUs)) {
+		delayUs = engine->rpmCalculator.oneDegreeUs * angle;
+	}
 
     // 'delayNt' is below 10 seconds here so we use 32 bit type for performance reasons
 	int32_t delayNt = USF2NT(delayUs);
@@ -124,6 +124,16 @@ public:
 		return oneDegreeUs;
 	}
 
+	/**
+	 * scheduleByAngle converts angle to time using instant RPM and its rate of change at the most
+	 * recent tooth instead of oneDegreeUs, see InstantRpmCalculator::getAngleToTimeUs
+	 */
+#if EFI_PREDICTIVE_ANGLE_SCHEDULING
+	bool predictiveAngleScheduling = true;
+#else
+	bool predictiveAngleScheduling = false;
+#endif // EFI_PREDICTIVE_ANGLE_SCHEDULING
+
 	Timer lastTdcTimer;
 
 	// RPM rate of change, in RPM per second
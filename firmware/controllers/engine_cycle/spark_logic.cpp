@@ -146,6 +146,7 @@ static void prepareCylinderIgnitionSchedule(angle_t dwellAngleDuration, floatms_
 	assertAngleRange(dwellStartAngle, "findAngle dwellStartAngle", ObdCode::CUSTOM_ERR_6550);
 	wrapAngle(dwellStartAngle, "findAngle#7", ObdCode::CUSTOM_ERR_6550);
 	event->dwellAngle = dwellStartAngle;
+	engine->ignitionEvents.dwellDispatch.setPhase(event->cylinderIndex, dwellStartAngle);
 
 #if FUEL_MATH_EXTREME_LOGGING
 	if (printFuelDebug) {
@@ -480,7 +481,14 @@ void onTriggerEventSparkLogic(int rpm, efitick_t edgeTimestamp, float currentPha
 
 //	scheduleSimpleMsg(&logger, "eventId spark ", eventIndex);
 	if (engine->ignitionEvents.isReady) {
-		for (size_t i = 0; i < engineConfiguration->cylindersCount; i++) {
+		// only cylinders with dwell start anywhere near this tooth
+		uint32_t candidates = engine->ignitionEvents.dwellDispatch.getCandidates(currentPhase, nextPhase)
+			& ((1U << engineConfiguration->cylindersCount) - 1);
+
+		while (candidates) {
+			size_t i = __builtin_ctz(candidates);
+			candidates &= candidates - 1;
+
 			IgnitionEvent *event = &engine->ignitionEvents.elements[i];
 
 			if (!isPhaseInRange(event->dwellAngle, currentPhase, nextPhase)) {
@@ -0,0 +1,296 @@
+/**
+ * @file    flash_journal.cpp
+ *
+ * See flash_journal.h for the layout
+ */
+
+#include "pch.h"
+
+#include "flash_journal.h"
+
+// image is compared with the stored content this many bytes at a time
+#define FLASH_JOURNAL_COMPARE_SIZE (4 * FLASH_JOURNAL_UNIT)
+
+static size_t alignUp(size_t size) {
+	return (size + FLASH_JOURNAL_UNIT - 1) / FLASH_JOURNAL_UNIT * FLASH_JOURNAL_UNIT;
+}
+
+static bool isErased(const uint8_t* buffer, size_t size) {
+	for (size_t i = 0; i < size; i++) {
+		if (buffer[i] != 0xFF) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static uint32_t getHeaderCrc(const FlashJournalHeader& header) {
+	return crc32((void*)&header, offsetof(FlashJournalHeader, headerCrc));
+}
+
+FlashJournal::FlashJournal(FlashJournalStorage& storage, size_t imageSize)
+	: m_storage(storage)
+	, m_imageSize(imageSize)
+	, m_journalStart(alignUp(imageSize))
+{
+}
+
+void FlashJournal::reset() {
+	m_isScanned = false;
+}
+
+bool FlashJournal::isDataValid(size_t position, size_t size, uint32_t expectedCrc) {
+	uint8_t buffer[FLASH_JOURNAL_COMPARE_SIZE];
+	uint32_t crc = 0;
+
+	while (size > 0) {
+		size_t chunk = size < sizeof(buffer) ? size : sizeof(buffer);
+		m_storage.read(position, buffer, chunk);
+		crc = crc32inc(buffer, crc, chunk);
+		position += chunk;
+		size -= chunk;
+	}
+
+	return crc == expectedCrc;
+}
+
+void FlashJournal::scan() {
+	m_isScanned = true;
+	m_isClean = true;
+	m_sequence = 0;
+
+	uint8_t firstUnit[FLASH_JOURNAL_UNIT];
+	m_storage.read(0, firstUnit, sizeof(firstUnit));
+	m_hasBaseImage = !isErased(firstUnit, sizeof(firstUnit));
+
+	size_t position = m_journalStart;
+	size_t pendingRecords = 0;
+	m_committedEnd = position;
+
+	while (position + FLASH_JOURNAL_UNIT <= m_storage.getSize()) {
+		FlashJournalHeader header;
+		m_storage.read(position, reinterpret_cast<uint8_t*>(&header), sizeof(header));
+
+		if (isErased(reinterpret_cast<uint8_t*>(&header), sizeof(header))) {
+			// end of the journal
+			break;
+		}
+
+		if (header.headerCrc != getHeaderCrc(header) || header.sequence != m_sequence + 1) {
+			m_isClean = false;
+			break;
+		}
+
+		if (header.magic == FLASH_JOURNAL_RECORD_MAGIC) {
+			size_t dataEnd = position + FLASH_JOURNAL_UNIT + alignUp(header.size);
+			if (header.offset > m_imageSize || header.size > m_imageSize - header.offset
+					|| dataEnd > m_storage.getSize()
+					|| !isDataValid(position + FLASH_JOURNAL_UNIT, header.size, header.dataCrc)) {
+				m_isClean = false;
+				break;
+			}
+
+			pendingRecords++;
+			position = dataEnd;
+		} else if (header.magic == FLASH_JOURNAL_COMMIT_MAGIC && header.size == pendingRecords) {
+			position += FLASH_JOURNAL_UNIT;
+			m_committedEnd = position;
+			m_sequence++;
+			pendingRecords = 0;
+		} else {
+			m_isClean = false;
+			break;
+		}
+	}
+
+	m_freeStart = position;
+
+	if (pendingRecords != 0) {
+		// power loss in the middle of a burn
+		m_isClean = false;
+	}
+}
+
+void FlashJournal::read(size_t offset, uint8_t* buffer, size_t size) {
+	if (!m_isScanned) {
+		scan();
+	}
+
+	m_storage.read(offset, buffer, size);
+
+	size_t end = offset + size;
+	size_t position = m_journalStart;
+	while (position < m_committedEnd) {
+		FlashJournalHeader header;
+		m_storage.read(position, reinterpret_cast<uint8_t*>(&header), sizeof(header));
+		position += FLASH_JOURNAL_UNIT;
+
+		if (header.magic != FLASH_JOURNAL_RECORD_MAGIC) {
+			continue;
+		}
+
+		size_t from = header.offset > offset ? header.offset : offset;
+		size_t to = header.offset + header.size < end ? header.offset + header.size : end;
+		if (from < to) {
+			m_storage.read(position + from - header.offset, buffer + from - offset, to - from);
+		}
+
+		position += alignUp(header.size);
+	}
+}
+
+bool FlashJournal::writeHeader(uint32_t magic, uint32_t offset, uint32_t size, uint32_t dataCrc) {
+	FlashJournalHeader header;
+	memset(&header, 0, sizeof(header));
+	header.magic = magic;
+	header.offset = offset;
+	header.size = size;
+	header.dataCrc = dataCrc;
+	header.sequence = m_sequence + 1;
+	header.headerCrc = getHeaderCrc(header);
+
+	if (!m_storage.write(m_freeStart, reinterpret_cast<const uint8_t*>(&header), sizeof(header))) {
+		return false;
+	}
+
+	m_freeStart += FLASH_JOURNAL_UNIT;
+	return true;
+}
+
+bool FlashJournal::appendRecord(const uint8_t* image, size_t offset, size_t size, size_t& recordCount) {
+	// keep a unit for the commit
+	if (m_freeStart + FLASH_JOURNAL_UNIT + alignUp(size) + FLASH_JOURNAL_UNIT > m_storage.getSize()) {
+		return false;
+	}
+
+	if (!writeHeader(FLASH_JOURNAL_RECORD_MAGIC, offset, size, crc32((void*)(image + offset), size))) {
+		return false;
+	}
+
+	size_t wholeUnits = size / FLASH_JOURNAL_UNIT * FLASH_JOURNAL_UNIT;
+	if (wholeUnits > 0 && !m_storage.write(m_freeStart, image + offset, wholeUnits)) {
+		return false;
+	}
+
+	if (size > wholeUnits) {
+		// end of the image, never write past the caller's buffer
+		uint8_t tail[FLASH_JOURNAL_UNIT];
+		memset(tail, 0xFF, sizeof(tail));
+		memcpy(tail, image + offset + wholeUnits, size - wholeUnits);
+		if (!m_storage.write(m_freeStart + wholeUnits, tail, sizeof(tail))) {
+			return false;
+		}
+	}
+
+	m_freeStart += alignUp(size);
+	recordCount++;
+	return true;
+}
+
+bool FlashJournal::append(const uint8_t* image, bool& isChanged) {
+	// anything written from now on is garbage until the commit
+	m_isClean = false;
+
+	size_t recordCount = 0;
+	bool hasRun = false;
+	size_t runStart = 0;
+	size_t runEnd = 0;
+
+	uint8_t stored[FLASH_JOURNAL_COMPARE_SIZE];
+	for (size_t chunk = 0; chunk < m_imageSize; chunk += sizeof(stored)) {
+		size_t chunkSize = m_imageSize - chunk < sizeof(stored) ? m_imageSize - chunk : sizeof(stored);
+		// only committed records are applied, so what this transaction has appended so far does not matter
+		read(chunk, stored, chunkSize);
+
+		for (size_t unit = 0; unit < chunkSize; unit += FLASH_JOURNAL_UNIT) {
+			size_t offset = chunk + unit;
+			size_t size = chunkSize - unit < FLASH_JOURNAL_UNIT ? chunkSize - unit : FLASH_JOURNAL_UNIT;
+			if (memcmp(stored + unit, image + offset, size) == 0) {
+				continue;
+			}
+
+			// one unchanged unit in between costs the same as a separate header
+			if (hasRun && offset - runEnd > FLASH_JOURNAL_UNIT) {
+				if (!appendRecord(image, runStart, runEnd - runStart, recordCount)) {
+					return false;
+				}
+				hasRun = false;
+			}
+
+			if (!hasRun) {
+				runStart = offset;
+				hasRun = true;
+			}
+			runEnd = offset + size;
+		}
+	}
+
+	if (hasRun && !appendRecord(image, runStart, runEnd - runStart, recordCount)) {
+		return false;
+	}
+
+	isChanged = recordCount > 0;
+	if (isChanged) {
+		if (!writeHeader(FLASH_JOURNAL_COMMIT_MAGIC, 0, recordCount, 0)) {
+			return false;
+		}
+
+		m_committedEnd = m_freeStart;
+		m_sequence++;
+	}
+
+	m_isClean = true;
+	return true;
+}
+
+bool FlashJournal::compact(const uint8_t* image) {
+	m_isScanned = true;
+	m_isClean = false;
+
+	if (!m_storage.erase()) {
+		return false;
+	}
+
+	m_hasBaseImage = false;
+	m_sequence = 0;
+	m_committedEnd = m_journalStart;
+	m_freeStart = m_journalStart;
+
+	if (!m_storage.write(0, image, m_imageSize)) {
+		return false;
+	}
+
+	m_hasBaseImage = true;
+	m_isClean = true;
+	return true;
+}
+
+FlashJournalResult FlashJournal::write(const uint8_t* image) {
+	if (!m_isScanned) {
+		scan();
+	}
+
+	if (m_isClean && m_hasBaseImage && m_sequence < FLASH_JOURNAL_MAX_TRANSACTIONS) {
+		bool isChanged;
+		if (append(image, isChanged)) {
+			return isChanged ? FlashJournalResult::Appended : FlashJournalResult::Unchanged;
+		}
+		// out of space or a write error, the uncommitted tail is ignored until the erase below
+	}
+
+	return compact(image) ? FlashJournalResult::Compacted : FlashJournalResult::Failed;
+}
+
+size_t FlashJournal::getTransactionCount() {
+	if (!m_isScanned) {
+		scan();
+	}
+	return m_sequence;
+}
+
+size_t FlashJournal::getFreeSpace() {
+	if (!m_isScanned) {
+		scan();
+	}
+	return m_storage.getSize() - m_freeStart;
+}
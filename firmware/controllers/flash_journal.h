@@ -0,0 +1,125 @@
+/**
+ * @file    flash_journal.h
+ * @brief	Journaled storage of the configuration image in NOR flash
+ *
+ * Erasing and rewriting the whole configuration on every burn is slow and wears out the flash.
+ * The configuration sectors are much larger than the image, so the space after the image is used as a journal:
+ * each burn appends only the regions which differ from what is already stored.
+ *
+ * Region layout:
+ *   base image, imageSize bytes
+ *   padding up to FLASH_JOURNAL_UNIT
+ *   transactions, each one is
+ *     record header unit + changed bytes padded to FLASH_JOURNAL_UNIT, one per changed region
+ *     commit unit
+ *
+ * Every unit is written exactly once after the erase, and a transaction only becomes visible with its commit unit.
+ * A burn interrupted by a power loss leaves an uncommitted tail which is ignored on read, so the previous
+ * configuration is still there. Once the journal is full, or has too many transactions, the region is erased
+ * and the current image is written as the new base image, same as a burn without the journal.
+ *
+ * The journal does not know about the flash driver, see FlashJournalStorage.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Smallest write unit: STM32H7 programs 256 bit flash words which can't be written twice,
+ * everybody else is happy with any multiple of 4 bytes.
+ */
+#define FLASH_JOURNAL_UNIT 32
+
+#ifndef FLASH_JOURNAL_MAX_TRANSACTIONS
+// reading the image walks all records, compact from time to time to keep that fast
+#define FLASH_JOURNAL_MAX_TRANSACTIONS 64
+#endif
+
+#define FLASH_JOURNAL_RECORD_MAGIC 0x4A524543
+#define FLASH_JOURNAL_COMMIT_MAGIC 0x4A434D54
+
+/**
+ * NOR flash region: erase sets everything to 0xFF, a write only goes into erased memory.
+ * Offsets are relative to the start of the region.
+ */
+class FlashJournalStorage {
+public:
+	virtual ~FlashJournalStorage() = default;
+
+	// everything erased together with the image, the journal takes what is left after the image
+	virtual size_t getSize() = 0;
+	// erase the whole region
+	virtual bool erase() = 0;
+	virtual bool write(size_t offset, const uint8_t* buffer, size_t size) = 0;
+	virtual void read(size_t offset, uint8_t* buffer, size_t size) = 0;
+};
+
+struct FlashJournalHeader {
+	uint32_t magic;
+	// record: where in the image, commit: zero
+	uint32_t offset;
+	// record: byte count, commit: record count of the transaction
+	uint32_t size;
+	uint32_t dataCrc;
+	// transaction number since the last compaction, starting from 1
+	uint32_t sequence;
+	uint32_t reserved[2];
+	// crc32 of all the fields above
+	uint32_t headerCrc;
+};
+
+static_assert(sizeof(FlashJournalHeader) == FLASH_JOURNAL_UNIT);
+
+enum class FlashJournalResult {
+	Unchanged,
+	Appended,
+	Compacted,
+	Failed,
+};
+
+class FlashJournal {
+public:
+	FlashJournal(FlashJournalStorage& storage, size_t imageSize);
+
+	/**
+	 * Reads the base image with all committed transactions applied
+	 */
+	void read(size_t offset, uint8_t* buffer, size_t size);
+
+	/**
+	 * Stores 'image' which is imageSize bytes, appending the difference if possible
+	 */
+	FlashJournalResult write(const uint8_t* image);
+
+	// forget everything known about the region, for example after somebody else has erased it
+	void reset();
+
+	size_t getTransactionCount();
+	size_t getFreeSpace();
+
+private:
+	void scan();
+	bool append(const uint8_t* image, bool& isChanged);
+	bool compact(const uint8_t* image);
+	bool appendRecord(const uint8_t* image, size_t offset, size_t size, size_t& recordCount);
+	bool writeHeader(uint32_t magic, uint32_t offset, uint32_t size, uint32_t dataCrc);
+	bool isDataValid(size_t position, size_t size, uint32_t expectedCrc);
+
+	FlashJournalStorage& m_storage;
+	const size_t m_imageSize;
+	// first unit after the base image
+	const size_t m_journalStart;
+
+	bool m_isScanned = false;
+	// false if there is something after the last commit, next write has to compact
+	bool m_isClean = false;
+	// compaction has written the image, as opposed to a blank chip
+	bool m_hasBaseImage = false;
+	// end of the last committed transaction
+	size_t m_committedEnd = 0;
+	// first unit not written since the last erase
+	size_t m_freeStart = 0;
+	uint32_t m_sequence = 0;
+};
@@ -28,6 +28,14 @@
 
 #include "runtime_state.h"
 
+#if EFI_STORAGE_INT_FLASH_JOURNAL
+#include "flash_journal.h"
+
+#if EFI_ACTIVE_CONFIGURATION_IN_FLASH
+#error "EFI_ACTIVE_CONFIGURATION_IN_FLASH reads the base image directly, it does not know about the journal"
+#endif
+#endif
+
 static bool needToWriteConfiguration = false;
 
 /* if we store settings externally */
@@ -152,6 +160,87 @@ int eraseAndFlashCopy(flashaddr_t storageAddress, const TStorage& data) {
 	return err;
 }
 
+#if EFI_STORAGE_INT_FLASH_JOURNAL
+/**
+ * One configuration copy: the sectors erased for the image, the journal is appended to the unused rest of them
+ */
+class IntFlashJournalStorage final : public FlashJournalStorage {
+public:
+	IntFlashJournalStorage(uintptr_t (*getAddress)())
+		: m_getAddress(getAddress)
+	{
+	}
+
+	size_t getSize() override {
+		flashaddr_t address = m_getAddress();
+		return intFlashEraseEnd(address, sizeof(persistent_config_container_s)) - address;
+	}
+
+	bool erase() override {
+		flashaddr_t address = m_getAddress();
+		auto err = intFlashErase(address, sizeof(persistent_config_container_s));
+		if (FLASH_RETURN_SUCCESS != err) {
+			criticalError("Failed to erase flash at 0x%08x: %d", address, err);
+			return false;
+		}
+		return true;
+	}
+
+	bool write(size_t offset, const uint8_t* buffer, size_t size) override {
+		flashaddr_t address = m_getAddress() + offset;
+		auto err = intFlashWrite(address, reinterpret_cast<const char*>(buffer), size);
+		if (FLASH_RETURN_SUCCESS != err) {
+			criticalError("Failed to write flash at 0x%08x: %d", address, err);
+			return false;
+		}
+		return true;
+	}
+
+	void read(size_t offset, uint8_t* buffer, size_t size) override {
+		intFlashRead(m_getAddress() + offset, reinterpret_cast<char*>(buffer), size);
+	}
+
+private:
+	uintptr_t (*const m_getAddress)();
+};
+
+static IntFlashJournalStorage firstCopyStorage(getFlashAddrFirstCopy);
+static IntFlashJournalStorage secondCopyStorage(getFlashAddrSecondCopy);
+static FlashJournal firstCopyJournal(firstCopyStorage, sizeof(persistent_config_container_s));
+static FlashJournal secondCopyJournal(secondCopyStorage, sizeof(persistent_config_container_s));
+
+static FlashJournal& getCopyJournal(flashaddr_t storageAddress) {
+	return storageAddress == getFlashAddrFirstCopy() ? firstCopyJournal : secondCopyJournal;
+}
+
+// Append the difference to a copy of the configuration, erase and write it from scratch once the journal is full
+static int journalFlashCopy(flashaddr_t storageAddress, const persistent_config_container_s& data) {
+	// error already reported, return
+	if (!storageAddress) {
+		return FLASH_RETURN_SUCCESS;
+	}
+
+	FlashJournal& journal = getCopyJournal(storageAddress);
+	switch (journal.write(reinterpret_cast<const uint8_t*>(&data))) {
+		case FlashJournalResult::Unchanged:
+			efiPrintf("Configuration at 0x%08x unchanged", storageAddress);
+			return FLASH_RETURN_SUCCESS;
+		case FlashJournalResult::Appended:
+			efiPrintf("Configuration at 0x%08x appended, %d transactions, %d bytes free", storageAddress,
+				(int)journal.getTransactionCount(), (int)journal.getFreeSpace());
+			return FLASH_RETURN_SUCCESS;
+		case FlashJournalResult::Compacted:
+			efiPrintf("Configuration at 0x%08x rewritten", storageAddress);
+			return FLASH_RETURN_SUCCESS;
+		case FlashJournalResult::Failed:
+			break;
+	}
+
+	// details already reported by IntFlashJournalStorage
+	return FLASH_RETURN_OPERROR;
+}
+#endif // EFI_STORAGE_INT_FLASH_JOURNAL
+
 bool burnWithoutFlash = false;
 
 void writeToFlashNow() {
@@ -183,6 +272,15 @@ void writeToFlashNow() {
 #endif
 
 #if EFI_STORAGE_INT_FLASH == TRUE
+#if EFI_STORAGE_INT_FLASH_JOURNAL
+	// Same two copies, one after the other: a power loss can only ever interrupt one of them
+	int result1 = journalFlashCopy(getFlashAddrFirstCopy(), persistentState);
+	int result2 = FLASH_RETURN_SUCCESS;
+	/* Only if second copy is supported */
+	if (getFlashAddrSecondCopy()) {
+		result2 = journalFlashCopy(getFlashAddrSecondCopy(), persistentState);
+	}
+#else
 	// Flash two copies
 	int result1 = eraseAndFlashCopy(getFlashAddrFirstCopy(), persistentState);
 	int result2 = FLASH_RETURN_SUCCESS;
@@ -190,6 +288,7 @@ void writeToFlashNow() {
 	if (getFlashAddrSecondCopy()) {
 		result2 = eraseAndFlashCopy(getFlashAddrSecondCopy(), persistentState);
 	}
+#endif // EFI_STORAGE_INT_FLASH_JOURNAL
 
 	// handle success/failure
 	isSuccess = (result1 == FLASH_RETURN_SUCCESS) && (result2 == FLASH_RETURN_SUCCESS);
@@ -230,7 +329,14 @@ static FlashState readOneConfigurationCopy(flashaddr_t address) {
 		return FlashState::BlankChip;
 	}
 
+#if EFI_STORAGE_INT_FLASH_JOURNAL
+	// base image with everything appended since the last compaction
+	FlashJournal& journal = getCopyJournal(address);
+	journal.reset();
+	journal.read(0, reinterpret_cast<uint8_t*>(&persistentState), sizeof(persistentState));
+#else
 	intFlashRead(address, (char *) &persistentState, sizeof(persistentState));
+#endif
 
 	auto flashCrc = flashStateCrc(persistentState);
 
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 1820602789
-#define TS_SIGNATURE "rusEFI master.2023.10.31.alphax-2chan.1820602789"
+#define SIGNATURE_HASH 3560252471
+#define TS_SIGNATURE "rusEFI master.2023.10.31.alphax-2chan.3560252471"
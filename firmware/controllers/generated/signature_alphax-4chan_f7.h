@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 3303607155
-#define TS_SIGNATURE "rusEFI master.2023.10.31.alphax-4chan_f7.3303607155"
+#define SIGNATURE_HASH 2086149857
+#define TS_SIGNATURE "rusEFI master.2023.10.31.alphax-4chan_f7.2086149857"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 755129249
-#define TS_SIGNATURE "rusEFI master.2023.10.31.alphax-8chan-revA.755129249"
+#define SIGNATURE_HASH 2511556147
+#define TS_SIGNATURE "rusEFI master.2023.10.31.alphax-8chan-revA.2511556147"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 296614442
-#define TS_SIGNATURE "rusEFI master.2023.10.31.alphax-8chan_f7.296614442"
+#define SIGNATURE_HASH 2837245880
+#define TS_SIGNATURE "rusEFI master.2023.10.31.alphax-8chan_f7.2837245880"
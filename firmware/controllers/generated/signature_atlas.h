@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 1492537836
-#define TS_SIGNATURE "rusEFI master.2023.10.31.atlas.1492537836"
+#define SIGNATURE_HASH 3762766974
+#define TS_SIGNATURE "rusEFI master.2023.10.31.atlas.3762766974"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 618039316
-#define TS_SIGNATURE "rusEFI master.2023.10.31.core8.618039316"
+#define SIGNATURE_HASH 2624036230
+#define TS_SIGNATURE "rusEFI master.2023.10.31.core8.2624036230"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on hellen_cypress_gen_config.bat by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 485590434
-#define TS_SIGNATURE "rusEFI master.2023.10.31.cypress.485590434"
+#define SIGNATURE_HASH 2755694640
+#define TS_SIGNATURE "rusEFI master.2023.10.31.cypress.2755694640"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 3219724185
-#define TS_SIGNATURE "rusEFI master.2023.10.31.f407-discovery.3219724185"
+#define SIGNATURE_HASH 123208203
+#define TS_SIGNATURE "rusEFI master.2023.10.31.f407-discovery.123208203"
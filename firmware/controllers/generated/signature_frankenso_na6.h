@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 1050895720
-#define TS_SIGNATURE "rusEFI master.2023.10.31.frankenso_na6.1050895720"
+#define SIGNATURE_HASH 2249355514
+#define TS_SIGNATURE "rusEFI master.2023.10.31.frankenso_na6.2249355514"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 884839899
-#define TS_SIGNATURE "rusEFI master.2023.10.31.harley81.884839899"
+#define SIGNATURE_HASH 2349629513
+#define TS_SIGNATURE "rusEFI master.2023.10.31.harley81.2349629513"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 2053296270
-#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen-112-17.2053296270"
+#define SIGNATURE_HASH 3268658460
+#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen-112-17.3268658460"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 3461253360
-#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen-112-mg1.3461253360"
+#define SIGNATURE_HASH 1996463458
+#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen-112-mg1.1996463458"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 2885890898
-#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen-gm-e67.2885890898"
+#define SIGNATURE_HASH 347219648
+#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen-gm-e67.347219648"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 3306273665
-#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen-honda-k.3306273665"
+#define SIGNATURE_HASH 2107682323
+#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen-honda-k.2107682323"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 1932757173
-#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen-nb1.1932757173"
+#define SIGNATURE_HASH 3414334759
+#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen-nb1.3414334759"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 2244436886
-#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen121nissan.2244436886"
+#define SIGNATURE_HASH 1031173636
+#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen121nissan.1031173636"
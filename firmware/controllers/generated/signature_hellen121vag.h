@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 2291112545
-#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen121vag.2291112545"
+#define SIGNATURE_HASH 809406451
+#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen121vag.809406451"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 3542287048
-#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen128.3542287048"
+#define SIGNATURE_HASH 1804736346
+#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen128.1804736346"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 3451031320
-#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen154hyundai.3451031320"
+#define SIGNATURE_HASH 1963170442
+#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen154hyundai.1963170442"
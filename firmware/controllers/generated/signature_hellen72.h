@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 1890943887
-#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen72.1890943887"
+#define SIGNATURE_HASH 3355743773
+#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen72.3355743773"
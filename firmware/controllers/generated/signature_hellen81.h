@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 3248650189
-#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen81.3248650189"
+#define SIGNATURE_HASH 2031313503
+#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen81.2031313503"
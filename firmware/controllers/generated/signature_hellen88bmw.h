@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 4073982054
-#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen88bmw.4073982054"
+#define SIGNATURE_HASH 1248140788
+#define TS_SIGNATURE "rusEFI master.2023.10.31.hellen88bmw.1248140788"
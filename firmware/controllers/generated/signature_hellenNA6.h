@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 4160493958
-#define TS_SIGNATURE "rusEFI master.2023.10.31.hellenNA6.4160493958"
+#define SIGNATURE_HASH 1330449428
+#define TS_SIGNATURE "rusEFI master.2023.10.31.hellenNA6.1330449428"
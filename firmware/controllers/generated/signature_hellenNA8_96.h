@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 2438793545
-#define TS_SIGNATURE "rusEFI master.2023.10.31.hellenNA8_96.2438793545"
+#define SIGNATURE_HASH 703339739
+#define TS_SIGNATURE "rusEFI master.2023.10.31.hellenNA8_96.703339739"
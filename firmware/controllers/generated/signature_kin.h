@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on kinetis_gen_config.bat by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 1579172364
-#define TS_SIGNATURE "rusEFI master.2023.10.31.kin.1579172364"
+#define SIGNATURE_HASH 3868284830
+#define TS_SIGNATURE "rusEFI master.2023.10.31.kin.3868284830"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 1016282064
-#define TS_SIGNATURE "rusEFI master.2023.10.31.m74_9.1016282064"
+#define SIGNATURE_HASH 2216832578
+#define TS_SIGNATURE "rusEFI master.2023.10.31.m74_9.2216832578"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 1067215906
-#define TS_SIGNATURE "rusEFI master.2023.10.31.mre_f4.1067215906"
+#define SIGNATURE_HASH 2267904432
+#define TS_SIGNATURE "rusEFI master.2023.10.31.mre_f4.2267904432"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 485590434
-#define TS_SIGNATURE "rusEFI master.2023.10.31.nucleo_f429.485590434"
+#define SIGNATURE_HASH 2755694640
+#define TS_SIGNATURE "rusEFI master.2023.10.31.nucleo_f429.2755694640"
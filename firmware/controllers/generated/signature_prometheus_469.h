@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 744835122
-#define TS_SIGNATURE "rusEFI master.2023.10.31.prometheus_469.744835122"
+#define SIGNATURE_HASH 2496945568
+#define TS_SIGNATURE "rusEFI master.2023.10.31.prometheus_469.2496945568"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 484604888
-#define TS_SIGNATURE "rusEFI master.2023.10.31.proteus_h7.484604888"
+#define SIGNATURE_HASH 2756931146
+#define TS_SIGNATURE "rusEFI master.2023.10.31.proteus_h7.2756931146"
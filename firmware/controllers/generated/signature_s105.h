@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 1943692740
-#define TS_SIGNATURE "rusEFI master.2023.10.31.s105.1943692740"
+#define SIGNATURE_HASH 3412815958
+#define TS_SIGNATURE "rusEFI master.2023.10.31.s105.3412815958"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 701708663
-#define TS_SIGNATURE "rusEFI master.2023.10.31.small-can-board.701708663"
+#define SIGNATURE_HASH 2439130341
+#define TS_SIGNATURE "rusEFI master.2023.10.31.small-can-board.2439130341"
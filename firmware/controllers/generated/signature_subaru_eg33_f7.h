@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on config/boards/subaru_eg33/config/gen_subaru_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 461128373
-#define TS_SIGNATURE "rusEFI master.2023.10.31.subaru_eg33_f7.461128373"
+#define SIGNATURE_HASH 2748143399
+#define TS_SIGNATURE "rusEFI master.2023.10.31.subaru_eg33_f7.2748143399"
@@ -2,5 +2,5 @@
 // was generated automatically by rusEFI tool config_definition.jar based on gen_config.sh by SignatureConsumer
 //
 
-#define SIGNATURE_HASH 2522851712
-#define TS_SIGNATURE "rusEFI master.2023.10.31.tdg-pdm8.2522851712"
+#define SIGNATURE_HASH 787397650
+#define TS_SIGNATURE "rusEFI master.2023.10.31.tdg-pdm8.787397650"
@@ -7,28 +7,68 @@ static constexpr size_t maxFilterCount = 48;
 static size_t filterCount = 0;
 static CanFilter filters[maxFilterCount];
 
+/**
+ * Filters matching exactly one ID live in an open addressed hash, so that a frame nobody listens to
+ * costs a probe or two instead of a scan of every filter. Masked filters are few and stay in a list.
+ */
+static constexpr size_t exactHashBits = 7;
+static constexpr size_t exactHashSize = 1 << exactHashBits;
+static_assert(exactHashSize >= 2 * maxFilterCount, "keep hash at most half full");
+
+// index into 'filters' plus one, zero is an empty slot
+static uint8_t exactFilters[exactHashSize];
+
+static size_t maskedFilterCount = 0;
+// index into 'filters', in order of addition
+static uint8_t maskedFilters[maxFilterCount];
+
+static size_t hashCanId(int32_t id) {
+	// Fibonacci hashing: top bits of multiplicative hash
+	return ((uint32_t)id * 2654435761u) >> (32 - exactHashBits);
+}
+
+static bool isBusAccepted(const CanFilter& filter, size_t busIndex) {
+	return filter.Bus == ANY_BUS || filter.Bus == (int)busIndex;
+}
+
 CanFilter* getFilterForId(size_t busIndex, int Id) {
-	for (size_t i = 0; i < filterCount; i++) {
-		auto& filter = filters[i];
+	// filters are applied in the order in which those were added, so we look for the lowest index
+	size_t best = filterCount;
+
+	// linear probing keeps filters with the same ID in order of addition, first acceptable one wins
+	for (size_t slot = hashCanId(Id & FILTER_SPECIFIC); exactFilters[slot]; slot = (slot + 1) & (exactHashSize - 1)) {
+		size_t index = exactFilters[slot] - 1;
+		auto& filter = filters[index];
 
-		if (filter.accept(Id)) {
-			if (filter.Bus == ANY_BUS || filter.Bus == (int)busIndex) {
-				return &filter;
-			}
+		if (filter.accept(Id) && isBusAccepted(filter, busIndex)) {
+			best = index;
+			break;
 		}
 	}
 
-	return nullptr;
+	for (size_t i = 0; i < maskedFilterCount && maskedFilters[i] < best; i++) {
+		auto& filter = filters[maskedFilters[i]];
+
+		if (filter.accept(Id) && isBusAccepted(filter, busIndex)) {
+			best = maskedFilters[i];
+			break;
+		}
+	}
+
+	return best < filterCount ? &filters[best] : nullptr;
 }
 
 void resetLuaCanRx() {
 	// Clear all lua filters - reloading the script will reinit them
 	filterCount = 0;
+	maskedFilterCount = 0;
+	memset(exactFilters, 0, sizeof(exactFilters));
 }
 
 void addLuaCanRxFilter(int32_t eid, uint32_t mask, int bus, int callback) {
 	if (filterCount >= maxFilterCount) {
 		criticalError("Too many Lua CAN RX filters");
+		return;
 	}
 
 	efiPrintf("Added Lua CAN RX filter id 0x%x mask 0x%x with%s custom function", eid, mask, (callback == -1 ? "out" : ""));
@@ -38,5 +78,15 @@ void addLuaCanRxFilter(int32_t eid, uint32_t mask, int bus, int callback) {
 	filters[filterCount].Bus = bus;
 	filters[filterCount].Callback = callback;
 
+	if (mask == FILTER_SPECIFIC && (eid & ~FILTER_SPECIFIC) == 0) {
+		size_t slot = hashCanId(eid);
+		while (exactFilters[slot]) {
+			slot = (slot + 1) & (exactHashSize - 1);
+		}
+		exactFilters[slot] = filterCount + 1;
+	} else {
+		maskedFilters[maskedFilterCount++] = filterCount;
+	}
+
 	filterCount++;
 }
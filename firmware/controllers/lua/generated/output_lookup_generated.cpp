@@ -2,8 +2,7 @@
 // generated by GetOutputValueConsumer.java
 #include "pch.h"
 #include "value_lookup.h"
-float getOutputValueByName(const char *name) {
-	int hash = djb2lowerCase(name);
+float getOutputValueByHash(const int hash, bool *isFound) {
 	switch(hash) {
 // sd_present
 		case -230533156:
@@ -740,6 +739,48 @@ float getOutputValueByName(const char *name) {
 // afr2GasolineScale
 		case 2029444810:
 			return engine->outputChannels.afr2GasolineScale;
+// luaTickMinUs
+		case -262217090:
+			return engine->outputChannels.luaTickMinUs;
+// luaTickAvgUs
+		case -275988584:
+			return engine->outputChannels.luaTickAvgUs;
+// luaTickMaxUs
+		case -262493696:
+			return engine->outputChannels.luaTickMaxUs;
+// luaCanRxMinUs
+		case 1866341359:
+			return engine->outputChannels.luaCanRxMinUs;
+// luaCanRxAvgUs
+		case 1852569865:
+			return engine->outputChannels.luaCanRxAvgUs;
+// luaCanRxMaxUs
+		case 1866064753:
+			return engine->outputChannels.luaCanRxMaxUs;
+// luaCanCallbackMinUs
+		case 1761822418:
+			return engine->outputChannels.luaCanCallbackMinUs;
+// luaCanCallbackAvgUs
+		case 1748050924:
+			return engine->outputChannels.luaCanCallbackAvgUs;
+// luaCanCallbackMaxUs
+		case 1761545812:
+			return engine->outputChannels.luaCanCallbackMaxUs;
+// luaHookBudgetAborts
+		case 118163134:
+			return engine->outputChannels.luaHookBudgetAborts;
+// luaLoadDuration
+		case -1371716531:
+			return engine->outputChannels.luaLoadDuration;
+// luaBytecodeCacheHits
+		case 356167362:
+			return engine->outputChannels.luaBytecodeCacheHits;
+// sdLogDroppedRecords
+		case -465948194:
+			return engine->outputChannels.sdLogDroppedRecords;
+// sdLogMaxWriteLatency
+		case -728620257:
+			return engine->outputChannels.sdLogMaxWriteLatency;
 // totalFuelCorrection
 #if EFI_ENGINE_CONTROL
 		case -1779658835:
@@ -866,6 +907,9 @@ float getOutputValueByName(const char *name) {
 // m_maximumRetard
 		case 164334513:
 			return ___engine.module<KnockController>()->m_maximumRetard;
+// m_knockDroppedWindows
+		case 1499882784:
+			return ___engine.module<KnockController>()->m_knockDroppedWindows;
 // isTpsInvalid
 #if EFI_BOOST_CONTROL
 		case -575666209:
@@ -1183,6 +1227,12 @@ float getOutputValueByName(const char *name) {
 		case 481450608:
 			return ___engine.lambdaMonitor.lambdaTimeSinceGood;
 	}
+	if (isFound) {
+		*isFound = false;
+	}
 	return EFI_ERROR_CODE;
 }
+float getOutputValueByName(const char *name) {
+	return getOutputValueByHash(djb2lowerCase(name));
+}
 #endif
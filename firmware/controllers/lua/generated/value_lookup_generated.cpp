@@ -1,8 +1,7 @@
 // generated by GetConfigValueConsumer.java
 #include "pch.h"
 #include "value_lookup.h"
-float getConfigValueByName(const char *name) {
-	int hash = djb2lowerCase(name);
+float getConfigValueByHash(const int hash, bool *isFound) {
 	switch(hash) {
 // startButtonSuppressOnStartUpMs
 		case 1856486116:
@@ -1729,9 +1728,21 @@ float getConfigValueByName(const char *name) {
 // speedometerPulsePerKm
 		case 1007396714:
 			return engineConfiguration->speedometerPulsePerKm;
+// luaHookBudget
+		case -2132298829:
+			return engineConfiguration->luaHookBudget;
+// sdCardLogSlowDivider
+		case 2072537540:
+			return engineConfiguration->sdCardLogSlowDivider;
+	}
+	if (isFound) {
+		*isFound = false;
 	}
 	return EFI_ERROR_CODE;
 }
+float getConfigValueByName(const char *name) {
+	return getConfigValueByHash(djb2lowerCase(name));
+}
 bool setConfigValueByName(const char *name, float value) {
 	int hash = djb2lowerCase(name);
 	switch(hash) {
@@ -4609,6 +4620,16 @@ bool setConfigValueByName(const char *name, float value) {
 	{
 		engineConfiguration->speedometerPulsePerKm = (int)value;
 		return 1;
+	}
+		case -2132298829:
+	{
+		engineConfiguration->luaHookBudget = (int)value;
+		return 1;
+	}
+		case 2072537540:
+	{
+		engineConfiguration->sdCardLogSlowDivider = (int)value;
+		return 1;
 	}
 	}
 	return 0;
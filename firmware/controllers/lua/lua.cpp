@@ -8,6 +8,8 @@
 #include "lua.hpp"
 #include "lua_hooks.h"
 #include "can_filter.h"
+#include "lua_small_object_pool.h"
+#include "lua_bytecode_cache.h"
 
 #define TAG "LUA "
 
@@ -30,20 +32,53 @@ LUA_HEAD_RAM_SECTION
 #endif
 ;
 
+#ifndef LUA_SMALL_OBJECT_POOL_CHUNK
+#define LUA_SMALL_OBJECT_POOL_CHUNK 512
+#endif // LUA_SMALL_OBJECT_POOL_CHUNK
+
+/**
+ * Small objects come from a size class pool, everything else from a general purpose heap.
+ * The pool takes its chunks from that same heap as it grows.
+ */
 class Heap {
 public:
 	memory_heap_t m_heap;
+	LuaSmallObjectPool m_pool;
 
 	size_t m_memoryUsed = 0;
+	size_t m_highWater = 0;
 	size_t m_size;
 	char* m_buffer;
 
 	void* alloc(size_t n) {
-		return chHeapAlloc(&m_heap, n);
+		if (!LuaSmallObjectPool::isSmall(n)) {
+			return chHeapAlloc(&m_heap, n);
+		}
+
+		void* result = m_pool.alloc(n);
+		if (!result) {
+			void* chunk = chHeapAlloc(&m_heap, LUA_SMALL_OBJECT_POOL_CHUNK);
+			size_t chunkSize = LUA_SMALL_OBJECT_POOL_CHUNK;
+			if (!chunk) {
+				// heap is too fragmented for a whole chunk, grow by just this one block
+				chunkSize = LuaSmallObjectPool::getBlockSize(n);
+				chunk = chHeapAlloc(&m_heap, chunkSize);
+			}
+			if (!chunk) {
+				return nullptr;
+			}
+			m_pool.addChunk(chunk, chunkSize);
+			result = m_pool.alloc(n);
+		}
+		return result;
 	}
 
-	void free(void* obj) {
-		chHeapFree(obj);
+	void free(void* obj, size_t n) {
+		if (LuaSmallObjectPool::isSmall(n)) {
+			m_pool.free(obj, n);
+		} else {
+			chHeapFree(obj);
+		}
 	}
 
 public:
@@ -66,26 +101,35 @@ public:
 		if (nsize == 0) {
 			// requested size is zero, free if necessary and return nullptr
 			if (ptr) {
-				free(ptr);
+				free(ptr, osize);
 				m_memoryUsed -= osize;
 			}
 
 			return nullptr;
 		}
 
+		if (ptr && LuaSmallObjectPool::isSmall(osize) && m_pool.canResizeInPlace(osize, nsize)) {
+			// same size class, nothing to move
+			m_pool.onResizedInPlace(osize, nsize);
+			updateUsed(nsize - osize);
+			return ptr;
+		}
+
 		void *new_mem = alloc(nsize);
-		m_memoryUsed += nsize;
 
 		if (!ptr) {
 			// No old pointer passed in, simply return allocated block
+			if (new_mem) {
+				updateUsed(nsize);
+			}
 			return new_mem;
 		}
 
 		// An old pointer was passed in, copy the old data in, then free
 		if (new_mem != nullptr) {
-			memcpy(new_mem, ptr, chHeapGetSize(ptr) > nsize ? nsize : chHeapGetSize(ptr));
-			free(ptr);
-			m_memoryUsed -= osize;
+			memcpy(new_mem, ptr, osize > nsize ? nsize : osize);
+			free(ptr, osize);
+			updateUsed(nsize - osize);
 		}
 
 		return new_mem;
@@ -99,11 +143,29 @@ public:
 		return m_memoryUsed;
 	}
 
+	size_t highWater() const {
+		return m_highWater;
+	}
+
+	const LuaSmallObjectPool& pool() const {
+		return m_pool;
+	}
+
 	// Use only in case of emergency - obliterates all heap objects and starts over
 	void reset() {
+		m_pool.reset();
 		chHeapObjectInit(&m_heap, m_buffer, m_size);
 		m_memoryUsed = 0;
 	}
+
+private:
+	// delta is modulo size_t arithmetic, shrinking wraps around to a subtraction
+	void updateUsed(size_t delta) {
+		m_memoryUsed += delta;
+		if (m_memoryUsed > m_highWater) {
+			m_highWater = m_memoryUsed;
+		}
+	}
 };
 
 static Heap userHeap(luaUserHeap);
@@ -113,6 +175,18 @@ static void printLuaMemoryInfo() {
 	auto memoryUsed = userHeap.used();
 	float pct = 100.0f * memoryUsed / heapSize;
 	efiPrintf("Lua memory heap usage: %d / %d bytes = %.1f%%", memoryUsed, heapSize, pct);
+	efiPrintf("Lua memory high water: %d bytes", userHeap.highWater());
+
+	auto& pool = userHeap.pool();
+	efiPrintf("Lua small object pool: %d / %d bytes carved from %d chunks, %d idle in free lists, %d slack",
+		pool.getCarvedBytes(), pool.getSize(), pool.getChunkCount(), pool.getIdleBytes(), pool.getSlackBytes());
+	for (size_t i = 0; i < pool.getClassCount(); i++) {
+		auto stats = pool.getClassStats(i);
+		efiPrintf("  %d byte blocks: %d in use, %d high water, %d idle", stats.blockSize, stats.inUse, stats.highWater, stats.idle);
+	}
+#if EFI_CAN_SUPPORT
+	efiPrintf("Lua CAN RX dropped frames: %d", getLuaCanRxDroppedFrames());
+#endif // EFI_CAN_SUPPORT
 }
 
 static void* myAlloc(void* /*ud*/, void* ptr, size_t osize, size_t nsize) {
@@ -151,6 +225,103 @@ static int lua_setTickRate(lua_State* l) {
 	return 0;
 }
 
+void LuaHookStats::reset(const char* name) {
+	m_count = 0;
+	m_minUs = 0;
+	m_maxUs = 0;
+	m_totalUs = 0;
+
+#if EFI_HISTOGRAMS
+	initHistogram(&m_histogram, name);
+#else
+	UNUSED(name);
+#endif // EFI_HISTOGRAMS
+}
+
+void LuaHookStats::add(uint32_t durationUs) {
+	if (m_count == 0 || durationUs < m_minUs) {
+		m_minUs = durationUs;
+	}
+	if (durationUs > m_maxUs) {
+		m_maxUs = durationUs;
+	}
+	m_totalUs += durationUs;
+	m_count++;
+
+#if EFI_HISTOGRAMS
+	hsAdd(&m_histogram, durationUs);
+#endif // EFI_HISTOGRAMS
+}
+
+void LuaHookStats::print() const {
+#if EFI_HISTOGRAMS
+	efiPrintf(TAG "%s: count %d min %dus avg %dus max %dus", m_histogram.name, m_count, getMinUs(), getAvgUs(), getMaxUs());
+
+	// see hsReport for what these numbers are
+	int report[5];
+	int len = hsReport(const_cast<histogram_s*>(&m_histogram), report);
+	for (int i = 0; i < len; i++) {
+		efiPrintf(TAG "  %d", report[i]);
+	}
+#else
+	efiPrintf(TAG "count %d min %dus avg %dus max %dus", m_count, getMinUs(), getAvgUs(), getMaxUs());
+#endif // EFI_HISTOGRAMS
+}
+
+static LuaHookStats hookStats[(size_t)LuaHookType::Count];
+static uint32_t hookBudgetAborts = 0;
+
+/**
+ * Count hook fires every this many VM instructions, the budget is checked at that granularity
+ */
+#define LUA_BUDGET_INSTRUCTION_STEP 1000
+
+static uint32_t budgetStepsLeft;
+
+static void luaBudgetHook(lua_State* l, lua_Debug* /*ar*/) {
+	if (budgetStepsLeft == 0) {
+		hookBudgetAborts++;
+		// unwinds to the lua_pcall in luaCallHook
+		luaL_error(l, "instruction budget of %dk exceeded", engineConfiguration->luaHookBudget);
+	}
+
+	budgetStepsLeft--;
+}
+
+int luaCallHook(lua_State* ls, LuaHookType type, int nargs) {
+	uint16_t budget = engineConfiguration->luaHookBudget;
+	if (budget) {
+		budgetStepsLeft = budget;
+		lua_sethook(ls, luaBudgetHook, LUA_MASKCOUNT, LUA_BUDGET_INSTRUCTION_STEP);
+	} else {
+		lua_sethook(ls, nullptr, 0, 0);
+	}
+
+	efitick_t startNt = getTimeNowNt();
+	int status = lua_pcall(ls, nargs, 0, 0);
+	hookStats[(size_t)type].add(NT2US(getTimeNowNt() - startNt));
+
+	// interactive commands and script loading are not limited
+	lua_sethook(ls, nullptr, 0, 0);
+
+	return status;
+}
+
+const LuaHookStats& getLuaHookStats(LuaHookType type) {
+	return hookStats[(size_t)type];
+}
+
+uint32_t getLuaHookBudgetAborts() {
+	return hookBudgetAborts;
+}
+
+void resetLuaHookStats() {
+	hookStats[(size_t)LuaHookType::Tick].reset("lua onTick");
+	hookStats[(size_t)LuaHookType::CanRx].reset("lua onCanRx");
+	hookStats[(size_t)LuaHookType::CanCallback].reset("lua CAN cb");
+	hookBudgetAborts = 0;
+}
+
 static void loadLibraries(LuaHandle& ls) {
 	constexpr luaL_Reg libs[] = {
 		// TODO: do we even need the base lib?
@@ -208,16 +379,55 @@ static void printLuaMemory() {
 #endif // LUA_USER_HEAP
 }
 
+#if EFI_LUA_BYTECODE_CACHE
+#ifndef LUA_BYTECODE_CACHE_SIZE
+#define LUA_BYTECODE_CACHE_SIZE 16000
+#endif // LUA_BYTECODE_CACHE_SIZE
+
+static uint8_t luaBytecodeBuffer[LUA_BYTECODE_CACHE_SIZE]
+#ifdef EFI_HAS_EXT_SDRAM
+SDRAM_OPTIONAL
+#endif
+;
+
+static LuaBytecodeCache bytecodeCache(luaBytecodeBuffer, sizeof(luaBytecodeBuffer));
+#endif // EFI_LUA_BYTECODE_CACHE
+
+static uint32_t lastLoadDurationUs = 0;
+
 static bool loadScript(LuaHandle& ls, const char* scriptStr) {
-	efiPrintf(TAG "loading script length: %d...", efiStrlen(scriptStr));
+	size_t length = efiStrlen(scriptStr);
+	efiPrintf(TAG "loading script length: %d...", length);
+
+	efitick_t startNt = getTimeNowNt();
+
+#if EFI_LUA_BYTECODE_CACHE
+	int status = bytecodeCache.load(ls, scriptStr, length);
+#else
+	int status = luaL_loadstring(ls, scriptStr);
+#endif // EFI_LUA_BYTECODE_CACHE
+
+	if (0 == status) {
+		// run the main chunk which defines functions and globals, same as luaL_dostring does
+		status = lua_pcall(ls, 0, LUA_MULTRET, 0);
+	}
 
-	if (0 != luaL_dostring(ls, scriptStr)) {
+	if (0 != status) {
 		efiPrintf(TAG "ERROR loading script: %s", lua_tostring(ls, -1));
 		lua_pop(ls, 1);
 		return false;
 	}
 
-	efiPrintf(TAG "script loaded successfully!");
+	lastLoadDurationUs = NT2US(getTimeNowNt() - startNt);
+
+#if EFI_LUA_BYTECODE_CACHE
+	efiPrintf(TAG "script loaded successfully%s in %dus, bytecode %d bytes",
+		bytecodeCache.wasLastLoadCached() ? " from cache" : "",
+		lastLoadDurationUs,
+		bytecodeCache.getBytecodeSize());
+#else
+	efiPrintf(TAG "script loaded successfully in %dus", lastLoadDurationUs);
+#endif // EFI_LUA_BYTECODE_CACHE
 
 #if EFI_PROD_CODE
 	printLuaMemoryInfo();
@@ -274,7 +484,7 @@ void invokeTick(LuaHandle& ls) {
 		return;
 	}
 
-	int status = lua_pcall(ls, 0, 0, 0);
+	int status = luaCallHook(ls, LuaHookType::Tick, 0);
 
 	if (0 != status) {
 		// error calling hook function
@@ -286,6 +496,29 @@ void invokeTick(LuaHandle& ls) {
 	lua_settop(ls, 0);
 }
 
+static uint16_t saturateU16(uint32_t value) {
+	return value > UINT16_MAX ? UINT16_MAX : value;
+}
+
+static void updateLuaHookLiveData() {
+	auto& tick = getLuaHookStats(LuaHookType::Tick);
+	engine->outputChannels.luaTickMinUs = saturateU16(tick.getMinUs());
+	engine->outputChannels.luaTickAvgUs = saturateU16(tick.getAvgUs());
+	engine->outputChannels.luaTickMaxUs = saturateU16(tick.getMaxUs());
+
+	auto& canRx = getLuaHookStats(LuaHookType::CanRx);
+	engine->outputChannels.luaCanRxMinUs = saturateU16(canRx.getMinUs());
+	engine->outputChannels.luaCanRxAvgUs = saturateU16(canRx.getAvgUs());
+	engine->outputChannels.luaCanRxMaxUs = saturateU16(canRx.getMaxUs());
+
+	auto& canCallback = getLuaHookStats(LuaHookType::CanCallback);
+	engine->outputChannels.luaCanCallbackMinUs = saturateU16(canCallback.getMinUs());
+	engine->outputChannels.luaCanCallbackAvgUs = saturateU16(canCallback.getAvgUs());
+	engine->outputChannels.luaCanCallbackMaxUs = saturateU16(canCallback.getMaxUs());
+
+	engine->outputChannels.luaHookBudgetAborts = saturateU16(getLuaHookBudgetAborts());
+}
+
 struct LuaThread : ThreadController<4096> {
 	LuaThread() : ThreadController("lua", PRIO_LUA) { }
 
@@ -329,6 +562,13 @@ static bool runOneLua(lua_Alloc alloc, const char* script) {
 		return false;
 	}
 
+	resetLuaHookStats();
+
+	engine->outputChannels.luaLoadDuration = lastLoadDurationUs;
+#if EFI_LUA_BYTECODE_CACHE
+	engine->outputChannels.luaBytecodeCacheHits = bytecodeCache.getHitCount();
+#endif // EFI_LUA_BYTECODE_CACHE
+
 	while (!needsReset && !chThdShouldTerminateX()) {
 		efitick_t beforeNt = getTimeNowNt();
 #if EFI_CAN_SUPPORT
@@ -344,6 +584,7 @@ static bool runOneLua(lua_Alloc alloc, const char* script) {
 		chThdSleep(TIME_US2I(luaTickPeriodUs));
 		engine->outputChannels.luaLastCycleDuration = (getTimeNowNt() - beforeNt);
 		engine->outputChannels.luaInvocationCounter++;
+		updateLuaHookLiveData();
 	}
 
 	resetLua();
@@ -416,6 +657,13 @@ void startLua() {
 	});
 
 	addConsoleAction("luamemory", printLuaMemoryInfo);
+
+	addConsoleAction("luastats", [](){
+		for (size_t i = 0; i < efi::size(hookStats); i++) {
+			hookStats[i].print();
+		}
+		efiPrintf(TAG "hooks aborted over budget: %d", getLuaHookBudgetAborts());
+	});
 #endif
 }
 
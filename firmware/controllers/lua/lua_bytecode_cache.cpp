@@ -0,0 +1,58 @@
+/**
+ * @file lua_bytecode_cache.cpp
+ */
+
+#include "pch.h"
+
+#include "lua_bytecode_cache.h"
+
+// error messages read "script:12: ..." and the chunk name is not stored in bytecode as a copy of the whole script
+#define LUA_CHUNK_NAME "=script"
+
+int LuaBytecodeCache::writer(lua_State* /*ls*/, const void* data, size_t size, void* ud) {
+	auto self = reinterpret_cast<LuaBytecodeCache*>(ud);
+
+	if (self->m_size + size > self->m_capacity) {
+		// does not fit, non-zero aborts lua_dump
+		return 1;
+	}
+
+	memcpy(self->m_buffer + self->m_size, data, size);
+	self->m_size += size;
+	return 0;
+}
+
+int LuaBytecodeCache::load(lua_State* ls, const char* script, size_t length) {
+	uint32_t scriptCrc = crc32(script, length);
+
+	if (m_valid && m_scriptLength == length && m_scriptCrc == scriptCrc) {
+		int status = luaL_loadbufferx(ls, reinterpret_cast<const char*>(m_buffer), m_size, LUA_CHUNK_NAME, "b");
+		if (status == LUA_OK) {
+			m_lastLoadCached = true;
+			m_hitCount++;
+			return status;
+		}
+
+		// should never happen, compile from text as if we had no cache
+		lua_pop(ls, 1);
+		m_valid = false;
+	}
+
+	m_lastLoadCached = false;
+
+	int status = luaL_loadbufferx(ls, script, length, LUA_CHUNK_NAME, "t");
+	if (status != LUA_OK) {
+		return status;
+	}
+
+	m_valid = false;
+	m_size = 0;
+	// keep debug info so that runtime errors still have line numbers
+	if (lua_dump(ls, writer, this, 0) == 0) {
+		m_valid = true;
+		m_scriptCrc = scriptCrc;
+		m_scriptLength = length;
+	}
+
+	return status;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file lua_bytecode_cache.h
+ *
+ * Keeps the lua_dump of the last compiled script so that restarting the same script
+ * skips the parser: faster reload and a lower heap peak since no parser state is allocated.
+ */
+
+#pragma once
+
+#include "lua.hpp"
+
+class LuaBytecodeCache {
+public:
+	LuaBytecodeCache(uint8_t* buffer, size_t capacity)
+		: m_buffer(buffer)
+		, m_capacity(capacity)
+	{
+	}
+
+	/**
+	 * Same contract as luaL_loadbuffer: on success the main chunk is left on top of the stack,
+	 * on error the message is.
+	 * Uses cached bytecode if it was compiled from this exact script text, otherwise compiles
+	 * the text and caches the result if it fits.
+	 */
+	int load(lua_State* ls, const char* script, size_t length);
+
+	bool wasLastLoadCached() const {
+		return m_lastLoadCached;
+	}
+
+	uint32_t getHitCount() const {
+		return m_hitCount;
+	}
+
+	size_t getBytecodeSize() const {
+		return m_valid ? m_size : 0;
+	}
+
+	void invalidate() {
+		m_valid = false;
+	}
+
+private:
+	static int writer(lua_State* ls, const void* data, size_t size, void* ud);
+
+	uint8_t* const m_buffer;
+	const size_t m_capacity;
+
+	size_t m_size = 0;
+	bool m_valid = false;
+	// script text the bytecode was compiled from
+	uint32_t m_scriptCrc = 0;
+	size_t m_scriptLength = 0;
+
+	bool m_lastLoadCached = false;
+	uint32_t m_hitCount = 0;
+};
@@ -21,6 +21,12 @@ chibios_rt::Mailbox<CanFrameData*, canFrameCount> freeBuffers;
 // CAN frame buffers that are waiting to be processed by the lua thread
 chibios_rt::Mailbox<CanFrameData*, canFrameCount> filledBuffers;
 
+static uint32_t droppedFrameCount = 0;
+
+uint32_t getLuaCanRxDroppedFrames() {
+	return droppedFrameCount;
+}
+
 void processLuaCan(const size_t busIndex, const CANRxFrame& frame) {
 	auto filter = getFilterForId(busIndex, CAN_ID(frame));
 
@@ -40,7 +46,7 @@ void processLuaCan(const size_t busIndex, const CANRxFrame& frame) {
 
 	if (msg != MSG_OK) {
 		// all buffers are already in use, this frame will be dropped!
-		// TODO: warn the user
+		droppedFrameCount++;
 		return;
 	}
 
@@ -89,7 +95,8 @@ static void handleCanFrame(LuaHandle& ls, CanFrameData* data) {
 	}
 
 	// Perform the actual function call
-	int status = lua_pcall(ls, 4, 0, 0);
+	auto hookType = data->Callback == NO_CALLBACK ? LuaHookType::CanRx : LuaHookType::CanCallback;
+	int status = luaCallHook(ls, hookType, 4);
 
 	if (0 != status) {
 		// error calling CAN rx hook function
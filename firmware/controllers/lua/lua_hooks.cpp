@@ -109,6 +109,18 @@ static int lua_getSensorByName(lua_State* l) {
 	return getSensor(l, type);
 }
 
+/**
+ * Name lookup is a scan of all sensor names, scripts which read a sensor often should resolve
+ * the name once and use getSensorByIndex with the returned handle
+ */
+static int lua_getSensorHandle(lua_State* l) {
+	auto sensorName = luaL_checklstring(l, 1, nullptr);
+	SensorType type = findSensorByName(l, sensorName);
+
+	lua_pushinteger(l, static_cast<int>(type));
+	return 1;
+}
+
 static int lua_getSensorRaw(lua_State* l) {
 	auto zeroBasedSensorIndex = luaL_checkinteger(l, 1);
 
@@ -659,6 +671,7 @@ void configureRusefiLuaHooks(lua_State* l) {
 	lua_register(l, "getAuxAnalog", lua_getAuxAnalog);
 	lua_register(l, "getSensorByIndex", lua_getSensorByIndex);
 	lua_register(l, "getSensor", lua_getSensorByName);
+	lua_register(l, "getSensorHandle", lua_getSensorHandle);
 	lua_register(l, "getSensorRaw", lua_getSensorRaw);
 	lua_register(l, "hasSensor", lua_hasSensor);
 	lua_register(l, "table3d", [](lua_State* l) {
@@ -852,6 +865,29 @@ void configureRusefiLuaHooks(lua_State* l) {
 		return 1;
 	});
 
+	// handle is the name hash, resolving it once saves hashing the name on every call
+	lua_register(l, "getCalibrationHandle", [](lua_State* l) {
+		auto propertyName = luaL_checklstring(l, 1, nullptr);
+		int handle = djb2lowerCase(propertyName);
+
+		bool isFound = true;
+		getConfigValueByHash(handle, &isFound);
+		if (!isFound) {
+			// unknown name or hash shared with another name, only getCalibration could tell those apart
+			luaL_error(l, "No handle for calibration [%s], use getCalibration", propertyName);
+		}
+
+		lua_pushinteger(l, handle);
+		return 1;
+	});
+
+	lua_register(l, "getCalibrationByHandle", [](lua_State* l) {
+		auto handle = luaL_checkinteger(l, 1);
+		auto result = getConfigValueByHash((int)handle);
+		lua_pushnumber(l, result);
+		return 1;
+	});
+
 #if EFI_TUNER_STUDIO && (EFI_PROD_CODE || EFI_SIMULATOR)
 	lua_register(l, "getOutput", [](lua_State* l) {
 		auto propertyName = luaL_checklstring(l, 1, nullptr);
@@ -861,6 +897,28 @@ void configureRusefiLuaHooks(lua_State* l) {
 		lua_pushnumber(l, result);
 		return 1;
 	});
+
+	lua_register(l, "getOutputHandle", [](lua_State* l) {
+		auto propertyName = luaL_checklstring(l, 1, nullptr);
+		int handle = djb2lowerCase(propertyName);
+
+		bool isFound = true;
+		getOutputValueByHash(handle, &isFound);
+		if (!isFound) {
+			luaL_error(l, "No handle for output [%s], use getOutput", propertyName);
+		}
+
+		lua_pushinteger(l, handle);
+		return 1;
+	});
+
+	// unlike getOutput this does not refresh output channels, values are as of the last TS/log update
+	lua_register(l, "getOutputByHandle", [](lua_State* l) {
+		auto handle = luaL_checkinteger(l, 1);
+		auto result = getOutputValueByHash((int)handle);
+		lua_pushnumber(l, result);
+		return 1;
+	});
 #endif // EFI_PROD_CODE || EFI_SIMULATOR
 
 #if EFI_SHAFT_POSITION_INPUT
@@ -892,6 +950,8 @@ void configureRusefiLuaHooks(lua_State* l) {
 		}
 		if (incrementVersion) {
 			incrementGlobalConfigurationVersion("lua");
+		} else {
+			invalidateTsPageCrc();
 		}
 		return 0;
 	});
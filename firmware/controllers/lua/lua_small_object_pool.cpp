@@ -0,0 +1,115 @@
+/**
+ * @file lua_small_object_pool.cpp
+ */
+
+#include "pch.h"
+
+#include "lua_small_object_pool.h"
+
+static constexpr size_t blockSizes[LUA_POOL_CLASS_COUNT] = { 16, 32, 48, 64, 96, 128 };
+static_assert(blockSizes[LUA_POOL_CLASS_COUNT - 1] == LuaSmallObjectPool::maxBlockSize);
+
+// size class by (size - 1) / 16
+static constexpr uint8_t classBySixteenths[] = { 0, 1, 2, 3, 4, 4, 5, 5 };
+
+size_t LuaSmallObjectPool::getClassIndex(size_t size) {
+	return classBySixteenths[(size - 1) / 16];
+}
+
+size_t LuaSmallObjectPool::getBlockSize(size_t size) {
+	return blockSizes[getClassIndex(size)];
+}
+
+void LuaSmallObjectPool::reset() {
+	memset(m_classes, 0, sizeof(m_classes));
+	m_next = nullptr;
+	m_end = nullptr;
+	m_size = 0;
+	m_chunkCount = 0;
+	m_slackBytes = 0;
+}
+
+void LuaSmallObjectPool::pushFree(size_t index, void* ptr) {
+	SizeClass& sizeClass = m_classes[index];
+
+	FreeBlock* block = reinterpret_cast<FreeBlock*>(ptr);
+	block->next = sizeClass.freeList;
+	sizeClass.freeList = block;
+	sizeClass.idle++;
+}
+
+void LuaSmallObjectPool::addChunk(void* chunk, size_t size) {
+	// every block size is a multiple of 16, so the tail of the old chunk splits into whole blocks
+	for (int index = LUA_POOL_CLASS_COUNT - 1; index >= 0; index--) {
+		while ((size_t)(m_end - m_next) >= blockSizes[index]) {
+			pushFree(index, m_next);
+			m_next += blockSizes[index];
+		}
+	}
+
+	m_next = reinterpret_cast<char*>(chunk);
+	m_end = m_next + size;
+	m_size += size;
+	m_chunkCount++;
+}
+
+void* LuaSmallObjectPool::alloc(size_t size) {
+	if (!isSmall(size)) {
+		return nullptr;
+	}
+
+	size_t index = getClassIndex(size);
+	SizeClass& sizeClass = m_classes[index];
+	size_t blockSize = blockSizes[index];
+
+	void* result;
+	if (sizeClass.freeList) {
+		FreeBlock* block = sizeClass.freeList;
+		sizeClass.freeList = block->next;
+		sizeClass.idle--;
+		result = block;
+	} else if ((size_t)(m_end - m_next) >= blockSize) {
+		result = m_next;
+		m_next += blockSize;
+	} else {
+		return nullptr;
+	}
+
+	sizeClass.inUse++;
+	if (sizeClass.inUse > sizeClass.highWater) {
+		sizeClass.highWater = sizeClass.inUse;
+	}
+	m_slackBytes += blockSize - size;
+
+	return result;
+}
+
+void LuaSmallObjectPool::free(void* ptr, size_t size) {
+	size_t index = getClassIndex(size);
+
+	pushFree(index, ptr);
+
+	m_classes[index].inUse--;
+	m_slackBytes -= blockSizes[index] - size;
+}
+
+bool LuaSmallObjectPool::canResizeInPlace(size_t oldSize, size_t newSize) const {
+	return isSmall(newSize) && getClassIndex(oldSize) == getClassIndex(newSize);
+}
+
+void LuaSmallObjectPool::onResizedInPlace(size_t oldSize, size_t newSize) {
+	m_slackBytes = m_slackBytes + oldSize - newSize;
+}
+
+LuaSmallObjectPool::ClassStats LuaSmallObjectPool::getClassStats(size_t index) const {
+	const SizeClass& sizeClass = m_classes[index];
+	return { blockSizes[index], sizeClass.inUse, sizeClass.highWater, sizeClass.idle };
+}
+
+size_t LuaSmallObjectPool::getIdleBytes() const {
+	size_t result = 0;
+	for (size_t i = 0; i < LUA_POOL_CLASS_COUNT; i++) {
+		result += m_classes[i].idle * blockSizes[i];
+	}
+	return result;
+}
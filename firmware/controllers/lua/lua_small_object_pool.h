@@ -0,0 +1,115 @@
+/**
+ * @file lua_small_object_pool.h
+ *
+ * Lua allocates and frees lots of short strings, tables and closures. Serving those from per size
+ * class free lists keeps them from fragmenting the general purpose heap and makes allocation O(1).
+ * Lua always tells us the old block size, so blocks need no header and the size class of a block
+ * being freed is derived from its size.
+ *
+ * The pool reserves nothing up front: it carves blocks out of chunks which the owner takes from
+ * the general purpose heap whenever alloc() runs dry, so it only ever holds as much memory as the
+ * script's small object high water. Chunks are not given back until the whole heap is reset.
+ */
+
+#pragma once
+
+#define LUA_POOL_CLASS_COUNT 6
+
+class LuaSmallObjectPool {
+public:
+	static constexpr size_t maxBlockSize = 128;
+
+	/**
+	 * @return true if a block of this size is served by the pool. Every such block is, so
+	 * the size alone tells whether a block belongs to the pool.
+	 */
+	static bool isSmall(size_t size) {
+		return size != 0 && size <= maxBlockSize;
+	}
+
+	/**
+	 * @return size of the block which serves a request of 'size' bytes
+	 */
+	static size_t getBlockSize(size_t size);
+
+	// forget all chunks, used when the memory behind them is reset
+	void reset();
+
+	/**
+	 * Hand a chunk over to the pool. Whatever was left of the previous chunk goes to the free lists.
+	 * @param size a multiple of 16
+	 */
+	void addChunk(void* chunk, size_t size);
+
+	/**
+	 * @return nullptr if there is neither a free block of this size class nor space left
+	 * in the current chunk, caller is expected to addChunk() and retry
+	 */
+	void* alloc(size_t size);
+	/**
+	 * @param size the size which was requested for this block
+	 */
+	void free(void* ptr, size_t size);
+
+	/**
+	 * @return true if a pool block which was allocated for 'oldSize' bytes can be reused for 'newSize'
+	 */
+	bool canResizeInPlace(size_t oldSize, size_t newSize) const;
+	// bookkeeping for a block which was resized in place
+	void onResizedInPlace(size_t oldSize, size_t newSize);
+
+	struct ClassStats {
+		size_t blockSize;
+		uint32_t inUse;
+		uint32_t highWater;
+		uint32_t idle;
+	};
+
+	size_t getClassCount() const {
+		return LUA_POOL_CLASS_COUNT;
+	}
+	ClassStats getClassStats(size_t index) const;
+
+	// bytes of all chunks handed to the pool
+	size_t getSize() const {
+		return m_size;
+	}
+	uint32_t getChunkCount() const {
+		return m_chunkCount;
+	}
+	// bytes which were ever handed out to a size class
+	size_t getCarvedBytes() const {
+		return m_size - (m_end - m_next);
+	}
+	// carved blocks sitting in free lists, only reusable by their own size class
+	size_t getIdleBytes() const;
+	// difference between block size and requested size, summed over blocks in use
+	size_t getSlackBytes() const {
+		return m_slackBytes;
+	}
+
+private:
+	struct FreeBlock {
+		FreeBlock* next;
+	};
+
+	struct SizeClass {
+		FreeBlock* freeList;
+		uint32_t inUse;
+		uint32_t highWater;
+		uint32_t idle;
+	};
+
+	static size_t getClassIndex(size_t size);
+	void pushFree(size_t index, void* ptr);
+
+	SizeClass m_classes[LUA_POOL_CLASS_COUNT] = {};
+
+	// start of the part of the current chunk which was never handed out
+	char* m_next = nullptr;
+	char* m_end = nullptr;
+
+	size_t m_size = 0;
+	uint32_t m_chunkCount = 0;
+	size_t m_slackBytes = 0;
+};
@@ -4,6 +4,10 @@
 
 #include "lua.hpp"
 
+#if EFI_HISTOGRAMS
+#include "histogram.h"
+#endif // EFI_HISTOGRAMS
+
 class LuaHandle final {
 public:
 	LuaHandle() : LuaHandle(nullptr) { }
@@ -43,6 +47,47 @@ private:
 
 void startLua();
 
+enum class LuaHookType : uint8_t {
+	Tick,
+	CanRx,
+	CanCallback,
+	Count,
+};
+
+// Execution time of one kind of script hook since the script was loaded
+class LuaHookStats {
+public:
+	void reset(const char* name);
+	void add(uint32_t durationUs);
+
+	uint32_t getCount() const { return m_count; }
+	uint32_t getMinUs() const { return m_count ? m_minUs : 0; }
+	uint32_t getMaxUs() const { return m_maxUs; }
+	uint32_t getAvgUs() const { return m_count ? m_totalUs / m_count : 0; }
+
+	void print() const;
+
+private:
+	uint32_t m_count = 0;
+	uint32_t m_minUs = 0;
+	uint32_t m_maxUs = 0;
+	uint64_t m_totalUs = 0;
+
+#if EFI_HISTOGRAMS
+	histogram_s m_histogram;
+#endif // EFI_HISTOGRAMS
+};
+
+/**
+ * Calls the function on top of the stack with 'nargs' arguments like lua_pcall, under the
+ * luaHookBudget instruction limit, and accounts the time spent to the given hook type.
+ * @return lua_pcall status
+ */
+int luaCallHook(lua_State* ls, LuaHookType type, int nargs);
+const LuaHookStats& getLuaHookStats(LuaHookType type);
+uint32_t getLuaHookBudgetAborts();
+void resetLuaHookStats();
+
 #if EFI_UNIT_TEST
 #include <rusefi/expected.h>
 
@@ -63,4 +108,6 @@ void initLuaCanRx();
 void doLuaCanRx(LuaHandle& ls);
 // Called from the CAN RX thread to queue a frame for Lua consumption
 void processLuaCan(const size_t busIndex, const CANRxFrame& frame);
+// Frames which matched a filter but were lost since Lua had not caught up with the queue
+uint32_t getLuaCanRxDroppedFrames();
 #endif // not EFI_CAN_SUPPORT
@@ -39,10 +39,16 @@ T* findPair(const char *name, T array[TCount], size_t count) {
 }
 
 float getConfigValueByName(const char *name);
+/**
+ * @param hash djb2lowerCase of the name, lets callers resolve a name once
+ * @param isFound set to false if the hash is unknown or shared by several names, by-name lookup is needed for those
+ */
+float getConfigValueByHash(const int hash, bool *isFound = nullptr);
 /**
  * @return true if name was recognized, false otherwise
  */
 bool setConfigValueByName(const char *name, float value);
 float getOutputValueByName(const char *name);
+float getOutputValueByHash(const int hash, bool *isFound = nullptr);
 
 void * hackEngineConfigurationPointer(void *ptr);
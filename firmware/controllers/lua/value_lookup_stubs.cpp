@@ -14,10 +14,24 @@ float getOutputValueByName(const char * /*name*/) {
 	return EFI_ERROR_CODE;
 }
 
+float getOutputValueByHash(const int /*hash*/, bool *isFound) {
+	if (isFound) {
+		*isFound = false;
+	}
+	return EFI_ERROR_CODE;
+}
+
 float getConfigValueByName(const char * /*name*/) {
 	return EFI_ERROR_CODE;
 }
 
+float getConfigValueByHash(const int /*hash*/, bool *isFound) {
+	if (isFound) {
+		*isFound = false;
+	}
+	return EFI_ERROR_CODE;
+}
+
 bool setConfigValueByName(const char * /*name*/, float /*value*/) {
 	return false;
 }
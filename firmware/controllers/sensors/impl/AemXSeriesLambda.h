@@ -9,6 +9,10 @@ public:
 	AemXSeriesWideband(uint8_t sensorIndex, SensorType type);
 
 	bool acceptFrame(const CANRxFrame& frame) const override;
+	bool acceptsOnlyOwnId() const override {
+		// we listen to three IDs
+		return false;
+	}
 
 protected:
 	// Dispatches to one of the three decoders below
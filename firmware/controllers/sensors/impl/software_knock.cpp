@@ -1,29 +1,92 @@
 #include "pch.h"
 
 #include "biquad.h"
+#include "goertzel.h"
 #include "thread_controller.h"
 #include "knock_logic.h"
 #include "software_knock.h"
 
+// todo: reduce magic constants. engineConfiguration->adcVcc?
+static constexpr float knockAdcRatio = 3.3f / 4095.0f;
+
+// quietest value we ever report, also what an empty window gives
+static constexpr float knockMinDb = -100;
+
+float getKnockWindowDb(Biquad& filter, const uint16_t *samples, size_t count) {
+	if (count == 0) {
+		return knockMinDb;
+	}
+
+	// Prepare the steady state at vcc/2 so that there isn't a step
+	// when samples begin
+	filter.cookSteadyState(3.3f / 2);
+
+	float lastFiltered;
+	float sumSq = filter.filterSumSquares(samples, count, knockAdcRatio, &lastFiltered);
+
+	if (engineConfiguration->debugMode == DBG_KNOCK) {
+		engine->outputChannels.debugFloatField1 = knockAdcRatio * samples[count - 1];
+		engine->outputChannels.debugFloatField2 = lastFiltered;
+	}
+
+	// mean of squares (not yet root)
+	float meanSquares = sumSq / count;
+
+	// RMS
+	float db = 10 * log10(meanSquares);
+
+	// clamp to reasonable range
+	return clampF(knockMinDb, db, 100);
+}
+
+size_t getKnockWindowSpectrumDb(const GoertzelBank& bank, const uint16_t *samples, size_t count, float *bandDb) {
+	size_t bandCount = bank.getBandCount();
+	if (count == 0) {
+		for (size_t i = 0; i < bandCount; i++) {
+			bandDb[i] = knockMinDb;
+		}
+		return bandCount;
+	}
+
+	float meanSquares[GOERTZEL_MAX_BANDS];
+	// sensor is biased to vcc/2, same as the bandpass steady state
+	bank.process(samples, count, 3.3f / 2 / knockAdcRatio, knockAdcRatio, meanSquares);
+
+	for (size_t i = 0; i < bandCount; i++) {
+		bandDb[i] = clampF(knockMinDb, 10 * log10(meanSquares[i]), 100);
+	}
+
+	return bandCount;
+}
+
+int acquireKnockWindow(KnockSampleRing& ring, bool adcReady) {
+	// ADC still sampling the previous window, or all buffers are waiting for knock thread
+	int index = adcReady ? ring.acquire() : -1;
+
+	if (index < 0) {
+		engine->module<KnockController>()->onKnockSenseDropped();
+	}
+
+	return index;
+}
+
 #if EFI_SOFTWARE_KNOCK
 
 #include "knock_config.h"
 #include "ch.hpp"
 
-static NO_CACHE adcsample_t sampleBuffer[2000];
-static int8_t currentCylinderNumber = 0;
-static efitick_t lastKnockSampleTime = 0;
-static Biquad knockFilter;
+static NO_CACHE adcsample_t sampleBuffers[KNOCK_SAMPLE_BUFFER_COUNT][2000];
 
-static volatile bool knockIsSampling = false;
-static volatile bool knockNeedsProcess = false;
-static volatile size_t sampleCount = 0;
+static KnockSampleRing sampleRing;
+
+static Biquad knockFilter;
+static GoertzelBank knockSpectrum;
 
 chibios_rt::BinarySemaphore knockSem(/* taken =*/ true);
 
 static void completionCallback(ADCDriver* adcp) {
 	if (adcp->state == ADC_COMPLETE) {
-		knockNeedsProcess = true;
+		sampleRing.onCompleted();
 
 		// Notify the processing thread that it's time to process this sample
 		chSysLockFromISR();
@@ -107,30 +170,32 @@ void onStartKnockSampling(uint8_t cylinderNumber, float samplingSeconds, uint8_t
 		return;
 	}
 
-	// Cancel if ADC isn't ready
-	if (!((KNOCK_ADC.state == ADC_READY) ||
+	// ADC isn't ready while previous window is still being sampled
+	bool adcReady = (KNOCK_ADC.state == ADC_READY) ||
 			(KNOCK_ADC.state == ADC_COMPLETE) ||
-			(KNOCK_ADC.state == ADC_ERROR))) {
-		return;
-	}
+			(KNOCK_ADC.state == ADC_ERROR);
 
-	// If there's pending processing, skip this event
-	if (knockNeedsProcess) {
+	int index = acquireKnockWindow(sampleRing, adcReady);
+	if (index < 0) {
 		return;
 	}
 
+	adcsample_t *buffer = sampleBuffers[index];
+	KnockSampleWindow& window = sampleRing.getWindow(index);
+
 	// Convert sampling time to number of samples
 	constexpr int sampleRate = KNOCK_SAMPLE_RATE;
-	sampleCount = 0xFFFFFFFE & static_cast<size_t>(clampF(100, samplingSeconds * sampleRate, efi::size(sampleBuffer)));
+	window.sampleCount = 0xFFFFFFFE & static_cast<size_t>(clampF(100, samplingSeconds * sampleRate, efi::size(sampleBuffers[0])));
 
 	// Select the appropriate conversion group - it will differ depending on which sensor this cylinder should listen on
 	auto conversionGroup = getConversionGroup(channelIdx);
 
 	// Stash the current cylinder's number so we can store the result appropriately
-	currentCylinderNumber = cylinderNumber;
+	window.cylinderNumber = cylinderNumber;
+	window.startTime = getTimeNowNt();
 
-	adcStartConversionI(&KNOCK_ADC, conversionGroup, sampleBuffer, sampleCount);
-	lastKnockSampleTime = getTimeNowNt();
+	sampleRing.onStarted();
+	adcStartConversionI(&KNOCK_ADC, conversionGroup, buffer, window.sampleCount);
 }
 
 class KnockThread : public ThreadController<UTILITY_THREAD_STACK_SIZE> {
@@ -144,6 +209,14 @@ static KnockThread kt;
 void initSoftwareKnock() {
 	if (engineConfiguration->enableSoftwareKnock) {
 		knockFilter.configureBandpass(KNOCK_SAMPLE_RATE, 1000 * engineConfiguration->knockBandCustom, 3);
+
+		static_assert(KNOCK_SPECTRUM_BANDS <= GOERTZEL_MAX_BANDS);
+		float bands[KNOCK_SPECTRUM_BANDS];
+		for (size_t i = 0; i < KNOCK_SPECTRUM_BANDS; i++) {
+			bands[i] = 1000 * engineConfiguration->knockSpectrumBands[i];
+		}
+		knockSpectrum.configure(KNOCK_SAMPLE_RATE, bands, KNOCK_SPECTRUM_BANDS);
+
 		adcStart(&KNOCK_ADC, nullptr);
 
 		efiSetPadMode("knock ch1", KNOCK_PIN_CH1, PAL_MODE_INPUT_ANALOG);
@@ -154,52 +227,25 @@ void initSoftwareKnock() {
 	}
 }
 
-void processLastKnockEvent() {
-	if (!knockNeedsProcess) {
-		return;
-	}
-
-	float sumSq = 0;
-
-	// todo: reduce magic constants. engineConfiguration->adcVcc?
-	constexpr float ratio = 3.3f / 4095.0f;
-
-	size_t localCount = sampleCount;
-
-	// Prepare the steady state at vcc/2 so that there isn't a step
-	// when samples begin
-	// todo: reduce magic constants. engineConfiguration->adcVcc?
-	knockFilter.cookSteadyState(3.3f / 2);
-
-	// Compute the sum of squares
-	for (size_t i = 0; i < localCount; i++) {
-		float volts = ratio * sampleBuffer[i];
-
-		float filtered = knockFilter.filter(volts);
-		if (i == localCount - 1 && engineConfiguration->debugMode == DBG_KNOCK) {
-			engine->outputChannels.debugFloatField1 = volts;
-			engine->outputChannels.debugFloatField2 = filtered;
-		}
-
-		sumSq += filtered * filtered;
+static void processKnockWindow(const adcsample_t *buffer, const KnockSampleWindow& window) {
+	// multi-band mode when any band frequency is configured
+	size_t bandCount = knockSpectrum.getBandCount();
+
+	if (bandCount > 0) {
+		float bandDb[GOERTZEL_MAX_BANDS];
+		getKnockWindowSpectrumDb(knockSpectrum, buffer, window.sampleCount, bandDb);
+		engine->module<KnockController>()->onKnockSenseCompleted(window.cylinderNumber, bandDb, bandCount, window.startTime);
+	} else {
+		float db = getKnockWindowDb(knockFilter, buffer, window.sampleCount);
+		engine->module<KnockController>()->onKnockSenseCompleted(window.cylinderNumber, db, window.startTime);
 	}
+}
 
-	// take a local copy
-	auto lastKnockTime = lastKnockSampleTime;
-
-	// We're done with inspecting the buffer, another sample can be taken
-	knockNeedsProcess = false;
-
-	// mean of squares (not yet root)
-	float meanSquares = sumSq / localCount;
-
-	// RMS
-	float db = 10 * log10(meanSquares);
-
-	// clamp to reasonable range
-	db = clampF(-100, db, 100);
-
-	engine->module<KnockController>()->onKnockSenseCompleted(currentCylinderNumber, db, lastKnockTime);
+void processLastKnockEvent() {
+	// drain everything ADC has completed, more than one window may be waiting
+	sampleRing.drain([](size_t index, const KnockSampleWindow& window) {
+		processKnockWindow(sampleBuffers[index], window);
+	});
 }
 
 void KnockThread::ThreadTask() {
@@ -6,3 +6,95 @@
 void initSoftwareKnock();
 void knockSamplingCallback(uint8_t cylinderIndex, efitick_t nowNt);
 void processLastKnockEvent();
+
+#ifndef KNOCK_SAMPLE_BUFFER_COUNT
+// two is enough for ADC to fill one while knock thread works on the other
+#define KNOCK_SAMPLE_BUFFER_COUNT 2
+#endif
+
+struct KnockSampleWindow {
+	size_t sampleCount;
+	uint8_t cylinderNumber;
+	efitick_t startTime;
+};
+
+/**
+ * Ring of knock sample buffers: ADC samples into the next free buffer while the knock thread
+ * works through completed ones.
+ * Free running counters, buffer index is counter modulo buffer count.
+ * 'started' and 'completed' are only written from ISR, 'processed' only from knock thread.
+ */
+class KnockSampleRing {
+public:
+	/**
+	 * Buffer the next window should be sampled into, -1 when every buffer is waiting for knock thread.
+	 * A window which has been started but never completed (ADC error) is simply reused.
+	 */
+	int acquire() const {
+		if (m_completed - m_processed >= KNOCK_SAMPLE_BUFFER_COUNT) {
+			return -1;
+		}
+
+		return m_completed % KNOCK_SAMPLE_BUFFER_COUNT;
+	}
+
+	KnockSampleWindow& getWindow(size_t index) {
+		return m_windows[index];
+	}
+
+	// ADC started sampling into the acquired buffer
+	void onStarted() {
+		m_started = m_completed + 1;
+	}
+
+	// ADC finished the started window
+	void onCompleted() {
+		m_completed = m_started;
+	}
+
+	/**
+	 * Hands every completed window to 'process' in sampling order, after which ADC may reuse its buffer.
+	 * @return number of windows processed
+	 */
+	template <typename TProcess>
+	size_t drain(TProcess process) {
+		size_t count = 0;
+
+		while (m_processed != m_completed) {
+			size_t index = m_processed % KNOCK_SAMPLE_BUFFER_COUNT;
+			process(index, m_windows[index]);
+
+			m_processed = m_processed + 1;
+			count++;
+		}
+
+		return count;
+	}
+
+private:
+	volatile uint32_t m_started = 0;
+	volatile uint32_t m_completed = 0;
+	volatile uint32_t m_processed = 0;
+
+	KnockSampleWindow m_windows[KNOCK_SAMPLE_BUFFER_COUNT] = {};
+};
+
+/**
+ * Picks the buffer for the next knock window. A window which cannot be sampled, because ADC is
+ * still busy or every buffer is waiting for processing, is counted as dropped in knock live data.
+ * @return buffer index or -1 if the window is dropped
+ */
+int acquireKnockWindow(KnockSampleRing& ring, bool adcReady);
+
+class Biquad;
+/**
+ * Filters one knock sampling window and returns its energy in dB, clamped to +-100
+ */
+float getKnockWindowDb(Biquad& filter, const uint16_t *samples, size_t count);
+
+class GoertzelBank;
+/**
+ * Energy of one knock sampling window at each configured band, in dB clamped to +-100
+ * @return number of bands written to 'bandDb'
+ */
+size_t getKnockWindowSpectrumDb(const GoertzelBank& bank, const uint16_t *samples, size_t count, float *bandDb);
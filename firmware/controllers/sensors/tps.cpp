@@ -3,11 +3,13 @@
  */
 #include "pch.h"
 #include "sent.h"
+#include "tunerstudio.h"
 
 void grabTPSIsClosed() {
 #if EFI_PROD_CODE
 	printTPSInfo();
 	engineConfiguration->tpsMin = convertVoltageTo10bitADC(Sensor::getRaw(SensorType::Tps1));
+	invalidateTsPageCrc();
 	printTPSInfo();
 #endif /* EFI_PROD_CODE */
 }
@@ -16,6 +18,7 @@ void grabTPSIsWideOpen() {
 #if EFI_PROD_CODE
 	printTPSInfo();
 	engineConfiguration->tpsMax = convertVoltageTo10bitADC(Sensor::getRaw(SensorType::Tps1));
+	invalidateTsPageCrc();
 	printTPSInfo();
 #endif /* EFI_PROD_CODE */
 }
@@ -17,6 +17,7 @@
 #include "alternator_controller.h"
 #include "trigger_emulator_algo.h"
 #include "value_lookup.h"
+#include "tunerstudio.h"
 #if EFI_RTC
 #include "rtc_helper.h"
 #endif // EFI_RTC
@@ -323,11 +324,13 @@ static void setWholeTimingMap(float value) {
 static void setWholePhaseMapCmd(float value) {
 	efiPrintf("Setting whole injection phase map to %.2f", value);
 	setTable(config->injectionPhase, value);
+	invalidateTsPageCrc();
 }
 
 static void setWholeTimingMapCmd(float value) {
 	efiPrintf("Setting whole timing advance map to %.2f", value);
 	setWholeTimingMap(value);
+	invalidateTsPageCrc();
 	engine->resetEngineSnifferIfInTestMode();
 }
 
@@ -337,9 +340,15 @@ static void setWholeVeCmd(float value) {
 		efiPrintf("WARNING: setting VE map not in SD mode is pointless");
 	}
 	setTable(config->veTable, value);
+	invalidateTsPageCrc();
 	engine->resetEngineSnifferIfInTestMode();
 }
 
+static void setWholeIgnitionIatCorrCmd(float value) {
+	setWholeIgnitionIatCorr(value);
+	invalidateTsPageCrc();
+}
+
 #if EFI_PROD_CODE
 
 static brain_pin_e parseBrainPinWithErrorMessage(const char *pinName) {
@@ -566,6 +575,7 @@ static void setSpiMode(int index, bool mode) {
 		efiPrintf("invalid spi index %d", index);
 		return;
 	}
+	invalidateTsPageCrc();
 	printSpiState(engineConfiguration);
 }
 
@@ -577,6 +587,8 @@ static void enableOrDisable(const char *param, bool isEnabled) {
 #if EFI_SHAFT_POSITION_INPUT
 	} else if (strEqualCaseInsensitive(param, CMD_TRIGGER_HW_INPUT)) {
 		getTriggerCentral()->hwTriggerInputEnabled = isEnabled;
+	} else if (strEqualCaseInsensitive(param, "predictive_angle_scheduling")) {
+		engine->rpmCalculator.predictiveAngleScheduling = isEnabled;
 #endif // EFI_SHAFT_POSITION_INPUT
 	} else if (strEqualCaseInsensitive(param, "verboseTLE8888")) {
 		engineConfiguration->verboseTLE8888 = isEnabled;
@@ -651,6 +663,7 @@ static void enableOrDisable(const char *param, bool isEnabled) {
 		efiPrintf("unexpected [%s]", param);
 		return; // well, MISRA would not like this 'return' here :(
 	}
+	invalidateTsPageCrc();
 	efiPrintf("[%s] %s", param, isEnabled ? "enabled" : "disabled");
 }
 
@@ -800,7 +813,7 @@ const command_i_s commandsI[] = {{"ignition_mode", setIgnitionMode},
 		//		{"", },
 };
 
-static void setValue(const char *paramStr, const char *valueStr) {
+static void applyValue(const char *paramStr, const char *valueStr) {
 	float valueF = atoff(valueStr);
 	int valueI = atoi(valueStr);
 
@@ -896,6 +909,12 @@ static void setValue(const char *paramStr, const char *valueStr) {
 	engine->resetEngineSnifferIfInTestMode();
 }
 
+static void setValue(const char *paramStr, const char *valueStr) {
+	applyValue(paramStr, valueStr);
+	// most setters above change configuration without bumping its version
+	invalidateTsPageCrc();
+}
+
 void initSettings() {
 #if EFI_SIMULATOR
 	printf("initSettings\n");
@@ -914,7 +933,7 @@ void initSettings() {
 	addConsoleActionF("set_whole_phase_map", setWholePhaseMapCmd);
 	addConsoleActionF("set_whole_timing_map", setWholeTimingMapCmd);
 	addConsoleActionF("set_whole_ve_map", setWholeVeCmd);
-	addConsoleActionF("set_whole_ign_corr_map", setWholeIgnitionIatCorr);
+	addConsoleActionF("set_whole_ign_corr_map", setWholeIgnitionIatCorrCmd);
 
 	addConsoleAction("stopengine", (Void) scheduleStopEngine);
 
@@ -103,6 +103,14 @@ public:
     	float frequencyHz = 1000.0 / periodMs;
     	this->m_period = CH_CFG_ST_FREQUENCY / frequencyHz;
     }
+
+    /**
+     * sets frequency, period is rounded to the nearest whole system tick but never below one tick
+     */
+    void setFrequency(float frequencyHz) {
+    	systime_t period = CH_CFG_ST_FREQUENCY / frequencyHz + 0.5f;
+    	this->m_period = period > 0 ? period : 1;
+    }
 };
 
 // let's make sure period is not below specified threshold
@@ -0,0 +1,131 @@
+/**
+ * @file record_ring_writer.h
+ *
+ * Single producer, single consumer ring of fixed size blocks.
+ *
+ * Producer writes a record with any number of write() calls between beginRecord() and commitRecord().
+ * A record which does not fit is dropped as a whole so that the consumer never sees a partial record.
+ * Consumer only takes completely filled blocks, so every write to storage is block aligned.
+ * The block which is still being filled can be peeked at, so that it gets to storage before it is complete.
+ */
+
+#pragma once
+
+#include "buffered_writer.h"
+
+#include <cstdint>
+
+template <size_t TBlockSize, size_t TBlockCount>
+class RecordRingWriter : public Writer {
+	static constexpr uint32_t capacity = TBlockSize * TBlockCount;
+	static_assert((capacity & (capacity - 1)) == 0, "capacity has to be a power of two for free running counters");
+
+public:
+	void beginRecord() {
+		m_recordStart = m_head;
+		m_overflow = false;
+	}
+
+	size_t write(const char* buffer, size_t count) override {
+		if (m_overflow) {
+			return 0;
+		}
+
+		if (m_head - m_tail + count > capacity) {
+			// not enough room until the consumer catches up
+			m_overflow = true;
+			return 0;
+		}
+
+		while (count) {
+			uint32_t offset = m_head % capacity;
+			size_t chunk = capacity - offset;
+			if (chunk > count) {
+				chunk = count;
+			}
+
+			memcpy(m_buffer + offset, buffer, chunk);
+			m_head += chunk;
+			buffer += chunk;
+			count -= chunk;
+		}
+
+		return 0;
+	}
+
+	size_t flush() override {
+		return 0;
+	}
+
+	/**
+	 * @return false if the record did not fit and was dropped
+	 */
+	bool commitRecord() {
+		if (m_overflow) {
+			m_head = m_recordStart;
+			m_droppedRecords++;
+			return false;
+		}
+
+		// publish to the consumer only once the whole record is in place
+		m_committed = m_head;
+		return true;
+	}
+
+	/**
+	 * @return longest run of full blocks which is contiguous in memory, nullptr if there is no full block yet
+	 */
+	const char* getFullBlocks(size_t& size) const {
+		uint32_t available = (m_committed - m_tail) / TBlockSize * TBlockSize;
+		if (available == 0) {
+			size = 0;
+			return nullptr;
+		}
+
+		uint32_t offset = m_tail % capacity;
+		// the run stops at the end of the buffer
+		size = available < capacity - offset ? available : capacity - offset;
+		return m_buffer + offset;
+	}
+
+	/**
+	 * @return committed bytes of the block which is still being filled, nullptr if there are none
+	 * or full blocks are waiting. These bytes stay in the ring until their block is full.
+	 */
+	const char* getPartialBlock(size_t& size) const {
+		uint32_t available = m_committed - m_tail;
+		if (available == 0 || available >= TBlockSize) {
+			size = 0;
+			return nullptr;
+		}
+
+		// tail only moves by whole blocks, so the partial block never wraps
+		size = available;
+		return m_buffer + m_tail % capacity;
+	}
+
+	void releaseBlocks(size_t size) {
+		m_tail += size;
+	}
+
+	uint32_t getDroppedRecords() const {
+		return m_droppedRecords;
+	}
+
+	// committed bytes not yet taken by the consumer
+	size_t getUsed() const {
+		return m_committed - m_tail;
+	}
+
+private:
+	char m_buffer[capacity];
+
+	// free running byte counters, only their difference matters
+	uint32_t m_head = 0;
+	uint32_t m_recordStart = 0;
+	volatile uint32_t m_committed = 0;
+	volatile uint32_t m_tail = 0;
+
+	bool m_overflow = false;
+	uint32_t m_droppedRecords = 0;
+};
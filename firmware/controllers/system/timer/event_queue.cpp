@@ -1,9 +1,9 @@
 /**
  * @file event_queue.cpp
  * This is a data structure which keeps track of all pending events
- * Implemented as a linked list, which is fine since the number of
- * pending events is pretty low
- * todo: MAYBE migrate to a better data structure, but that's low priority
+ * Sorted linked list by default, which is fine since the number of
+ * pending events is usually pretty low. EFI_EVENT_QUEUE_HEAP switches to a pairing heap
+ * for setups with dozens of pending events.
  *
  * this data structure is NOT thread safe
  *
@@ -48,27 +48,11 @@ bool EventQueue::insertTask(scheduling_s *scheduling, efitick_t timeX, action_s
 	scheduling->momentX = timeX;
 	scheduling->action = action;
 
-	if (head == NULL || timeX < head->momentX) {
-		// here we insert into head of the linked list
-		LL_PREPEND2(head, scheduling, nextScheduling_s);
+	bool isNewHead = storage.insert(scheduling);
 #if EFI_UNIT_TEST
-		assertListIsSorted();
-#endif /* EFI_UNIT_TEST */
-		return true;
-	} else {
-		// here we know we are not in the head of the list, let's find the position - linear search
-		scheduling_s *insertPosition = head;
-		while (insertPosition->nextScheduling_s != NULL && insertPosition->nextScheduling_s->momentX < timeX) {
-			insertPosition = insertPosition->nextScheduling_s;
-		}
-
-		scheduling->nextScheduling_s = insertPosition->nextScheduling_s;
-		insertPosition->nextScheduling_s = scheduling;
-#if EFI_UNIT_TEST
-		assertListIsSorted();
+	assertListIsSorted();
 #endif /* EFI_UNIT_TEST */
-		return false;
-	}
+	return isNewHead;
 }
 
 void EventQueue::remove(scheduling_s* scheduling) {
@@ -81,42 +65,20 @@ void EventQueue::remove(scheduling_s* scheduling) {
 		return;
 	}
 
-	// Special case: empty list, nothing to do
-	if (!head) {
+	// Special case: empty queue, nothing to do
+	if (!storage.top()) {
 		return;
 	}
 
-	// Special case: is the item to remove at the head?
-	if (scheduling == head) {
-		head = head->nextScheduling_s;
-		scheduling->nextScheduling_s = nullptr;
-		scheduling->action = {};
-	} else {
-		auto prev = head;	// keep track of the element before the one to remove, so we can link around it
-		auto current = prev->nextScheduling_s;
-
-		// Find our element
-		while (current && current != scheduling) {
-			prev = current;
-			current = current->nextScheduling_s;
-		}
-
-		// Walked off the end, this is an error since this *should* have been scheduled
-		if (!current) {
-			criticalError("EventQueue::remove didn't find element");
-			return;
-		}
-
-		criticalAssertVoid(current == scheduling, "current not equal to scheduling");
-
-		// Link around the removed item
-		prev->nextScheduling_s = current->nextScheduling_s;
-
-		// Clean the item to remove
-		current->nextScheduling_s = nullptr;
-		current->action = {};
+	if (!storage.remove(scheduling)) {
+		// this is an error since this *should* have been scheduled
+		criticalError("EventQueue::remove didn't find element");
+		return;
 	}
 
+	// Clean the item to remove
+	scheduling->action = {};
+
 #if EFI_UNIT_TEST
 	assertListIsSorted();
 #endif /* EFI_UNIT_TEST */
@@ -129,6 +91,7 @@ void EventQueue::remove(scheduling_s* scheduling) {
  * @return Get the timestamp of the soonest pending action, skipping all the actions in the past
  */
 expected<efitick_t> EventQueue::getNextEventTime(efitick_t nowX) const {
+	scheduling_s *head = storage.top();
 	if (head != NULL) {
 		if (head->momentX <= nowX) {
 			/**
@@ -178,7 +141,7 @@ int EventQueue::executeAll(efitick_t now) {
 bool EventQueue::executeOne(efitick_t now) {
 	// Read the head every time - a previously executed event could
 	// have inserted something new at the head
-	scheduling_s* current = head;
+	scheduling_s* current = storage.top();
 
 	// Queue is empty - bail
 	if (!current) {
@@ -203,8 +166,7 @@ bool EventQueue::executeOne(efitick_t now) {
 	}
 
 	// step the head forward, unlink this element, clear scheduled flag
-	head = current->nextScheduling_s;
-	current->nextScheduling_s = nullptr;
+	storage.pop();
 
 	// Grab the action but clear it in the event so we can reschedule from the action's execution
 	auto action = current->action;
@@ -229,50 +191,26 @@ bool EventQueue::executeOne(efitick_t now) {
 }
 
 int EventQueue::size(void) const {
-	scheduling_s *tmp;
-	int result;
-	LL_COUNT2(head, tmp, result, nextScheduling_s);
-	return result;
+	return storage.size();
 }
 
 void EventQueue::assertListIsSorted() const {
-	scheduling_s *current = head;
-	while (current != NULL && current->nextScheduling_s != NULL) {
-		efiAssertVoid(ObdCode::CUSTOM_ERR_6623, current->momentX <= current->nextScheduling_s->momentX, "list order");
-		current = current->nextScheduling_s;
-	}
+	storage.assertIsSorted();
 }
 
 scheduling_s * EventQueue::getHead() {
-	return head;
+	return storage.top();
 }
 
-// todo: reduce code duplication with another 'getElementAtIndexForUnitText'
 scheduling_s *EventQueue::getElementAtIndexForUnitText(int index) {
-	scheduling_s * current;
-
-	LL_FOREACH2(head, current, nextScheduling_s)
-	{
-		if (index == 0)
-			return current;
-		index--;
-	}
-
-	return NULL;
+	return storage.getElementAtIndexForUnitText(index);
 }
 
 void EventQueue::clear(void) {
 	// Flush the queue, resetting all scheduling_s as though we'd executed them
-	while(head) {
-		auto x = head;
-		// link next element to head
-		head = x->nextScheduling_s;
-
+	while (scheduling_s *x = storage.pop()) {
 		// Reset this element
 		x->momentX = 0;
-		x->nextScheduling_s = nullptr;
 		x->action = {};
 	}
-
-	head = nullptr;
 }
@@ -6,6 +6,8 @@
  */
 
 #include "scheduler.h"
+#include "scheduling_list.h"
+#include "scheduling_heap.h"
 #include "utlist.h"
 #include <rusefi/expected.h>
 
@@ -36,8 +38,15 @@
 	return false;
 
 
+#if EFI_EVENT_QUEUE_HEAP
+// bounded latency storage for setups with many pending events
+using EventQueueStorage = SchedulingHeap;
+#else
+using EventQueueStorage = SchedulingList;
+#endif /* EFI_EVENT_QUEUE_HEAP */
+
 /**
- * Execution sorted linked list
+ * Queue of pending events ordered by time, see EventQueueStorage for the data structure
  */
 class EventQueue {
 public:
@@ -47,7 +56,7 @@ public:
 	EventQueue(efitick_t lateDelay = 0) : lateDelay(lateDelay) {}
 
 	/**
-	 * O(size) - linear search in sorted linked list
+	 * O(size) with SchedulingList, O(1) with SchedulingHeap
 	 */
 	bool insertTask(scheduling_s *scheduling, efitick_t timeX, action_s action);
 	void remove(scheduling_s* scheduling);
@@ -62,10 +71,7 @@ public:
 	scheduling_s * getHead();
 	void assertListIsSorted() const;
 private:
-	/**
-	 * this list is sorted
-	 */
-	scheduling_s *head = nullptr;
+	EventQueueStorage storage;
 	const efitick_t lateDelay;
 };
 
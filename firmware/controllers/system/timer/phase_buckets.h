@@ -0,0 +1,102 @@
+/**
+ * @file phase_buckets.h
+ *
+ * Engine cycle split into fixed size phase buckets so that per-tooth code only looks at
+ * events which could be due between current and next tooth.
+ *
+ * Buckets are keyed by engine phase rather than trigger tooth index so that nothing
+ * has to be rebuilt on trigger shape, TDC offset or sync changes.
+ */
+
+#pragma once
+
+#define PHASE_BUCKET_COUNT 32
+
+static constexpr float phaseBucketWidth = FOUR_STROKE_CYCLE_DURATION / (float)PHASE_BUCKET_COUNT;
+
+static inline int getPhaseBucket(angle_t enginePhase) {
+	int bucket = (int)(enginePhase / phaseBucketWidth);
+	if (bucket < 0) {
+		return 0;
+	}
+	return bucket < PHASE_BUCKET_COUNT ? bucket : PHASE_BUCKET_COUNT - 1;
+}
+
+/**
+ * Invokes 'func' for each bucket which overlaps [currentPhase, nextPhase), see isPhaseInRange
+ */
+template<typename TFunc>
+void forEachPhaseBucket(float currentPhase, float nextPhase, TFunc func) {
+	int firstBucket = getPhaseBucket(currentPhase);
+	int lastBucket = getPhaseBucket(nextPhase);
+
+	// buckets between this tooth and the next one, inclusive
+	int bucketsToScan = lastBucket - firstBucket;
+	if (bucketsToScan < 0) {
+		// wrap around the end of engine cycle
+		bucketsToScan += PHASE_BUCKET_COUNT;
+	} else if (bucketsToScan == 0 && nextPhase <= currentPhase) {
+		// window spans the whole cycle
+		bucketsToScan = PHASE_BUCKET_COUNT - 1;
+	}
+
+	for (int i = 0; i <= bucketsToScan; i++) {
+		func((firstBucket + i) % PHASE_BUCKET_COUNT);
+	}
+}
+
+/**
+ * Maps phase bucket to a bitmask of per-cylinder events with an angle in that bucket.
+ * Angle updates are O(1) so the table can follow every recalculation of event angles.
+ */
+class PhaseDispatchTable {
+public:
+	PhaseDispatchTable() {
+		for (size_t i = 0; i < efi::size(bucketByIndex); i++) {
+			bucketByIndex[i] = -1;
+		}
+	}
+
+	void setPhase(size_t index, angle_t enginePhase) {
+		int bucket = cisnan(enginePhase) ? -1 : getPhaseBucket(enginePhase);
+		if (bucket == bucketByIndex[index]) {
+			return;
+		}
+
+		uint32_t bit = 1U << index;
+		if (bucketByIndex[index] >= 0) {
+			bucketMasks[bucketByIndex[index]] &= ~bit;
+		}
+		if (bucket >= 0) {
+			bucketMasks[bucket] |= bit;
+		}
+		bucketByIndex[index] = bucket;
+	}
+
+	/**
+	 * @return bitmask of events which could be due in [currentPhase, nextPhase),
+	 * caller still has to check exact angle with isPhaseInRange
+	 */
+	uint32_t getCandidates(float currentPhase, float nextPhase) const {
+#if EFI_UNIT_TEST
+		if (fullScanForUnitTest) {
+			return 0xFFFFFFFF;
+		}
+#endif // EFI_UNIT_TEST
+		uint32_t result = 0;
+		forEachPhaseBucket(currentPhase, nextPhase, [&](int bucket) {
+			result |= bucketMasks[bucket];
+		});
+		return result;
+	}
+
+#if EFI_UNIT_TEST
+	// every event is a candidate on every tooth, same as the loop over all cylinders we had before the table
+	bool fullScanForUnitTest = false;
+#endif // EFI_UNIT_TEST
+
+private:
+	uint32_t bucketMasks[PHASE_BUCKET_COUNT] = {};
+	static_assert(MAX_CYLINDER_COUNT <= 32, "one bit per cylinder");
+	int8_t bucketByIndex[MAX_CYLINDER_COUNT];
+};
@@ -52,9 +52,22 @@ struct scheduling_s {
 
 	/**
 	 * Scheduler implementation uses a sorted linked list of these scheduling records.
+	 * With EFI_EVENT_QUEUE_HEAP this is the next sibling in the pairing heap.
 	 */
 	scheduling_s *nextScheduling_s = nullptr;
 
+#if EFI_EVENT_QUEUE_HEAP || EFI_UNIT_TEST
+	/**
+	 * Pairing heap links, see scheduling_heap.h
+	 * leftmost child
+	 */
+	scheduling_s *childScheduling_s = nullptr;
+	/**
+	 * previous sibling, or parent for the leftmost child, or nullptr for heap root
+	 */
+	scheduling_s *prevScheduling_s = nullptr;
+#endif /* EFI_EVENT_QUEUE_HEAP || EFI_UNIT_TEST */
+
 	action_s action;
 };
 #pragma pack(pop)
@@ -0,0 +1,196 @@
+/**
+ * @file scheduling_heap.cpp
+ *
+ * Pairing heap: every node keeps the leftmost child and a doubly linked list of siblings
+ * which lets us cut any node out of the heap without searching for it.
+ * See Fredman, Sedgewick, Sleator, Tarjan "The pairing heap: a new form of self-adjusting heap"
+ */
+
+#include "pch.h"
+
+#include "scheduling_heap.h"
+
+#if EFI_EVENT_QUEUE_HEAP || EFI_UNIT_TEST
+
+/**
+ * Links two detached heaps, the one with the later timestamp becomes leftmost child of the other
+ */
+static scheduling_s * meld(scheduling_s *a, scheduling_s *b) {
+	if (!a) {
+		return b;
+	}
+	if (!b) {
+		return a;
+	}
+	if (b->momentX < a->momentX) {
+		scheduling_s *tmp = a;
+		a = b;
+		b = tmp;
+	}
+
+	b->prevScheduling_s = a;
+	b->nextScheduling_s = a->childScheduling_s;
+	if (a->childScheduling_s) {
+		a->childScheduling_s->prevScheduling_s = b;
+	}
+	a->childScheduling_s = b;
+	return a;
+}
+
+/**
+ * Standard two-pass pairing: meld siblings pairwise left to right, then meld the results right to left
+ */
+static scheduling_s * mergePairs(scheduling_s *first) {
+	// first pass, results are collected into a reversed list so that second pass does not need recursion
+	scheduling_s *pairs = nullptr;
+	while (first) {
+		scheduling_s *a = first;
+		scheduling_s *b = a->nextScheduling_s;
+		first = b ? b->nextScheduling_s : nullptr;
+
+		a->nextScheduling_s = a->prevScheduling_s = nullptr;
+		if (b) {
+			b->nextScheduling_s = b->prevScheduling_s = nullptr;
+		}
+
+		scheduling_s *melded = meld(a, b);
+		melded->nextScheduling_s = pairs;
+		pairs = melded;
+	}
+
+	// second pass
+	scheduling_s *result = nullptr;
+	while (pairs) {
+		scheduling_s *next = pairs->nextScheduling_s;
+		pairs->nextScheduling_s = nullptr;
+		result = meld(result, pairs);
+		pairs = next;
+	}
+
+	if (result) {
+		result->prevScheduling_s = nullptr;
+	}
+	return result;
+}
+
+bool SchedulingHeap::insert(scheduling_s *scheduling) {
+	scheduling->nextScheduling_s = nullptr;
+	scheduling->prevScheduling_s = nullptr;
+	scheduling->childScheduling_s = nullptr;
+
+	root = meld(root, scheduling);
+	count++;
+	return root == scheduling;
+}
+
+scheduling_s * SchedulingHeap::pop() {
+	scheduling_s *current = root;
+	if (current) {
+		root = mergePairs(current->childScheduling_s);
+		current->childScheduling_s = nullptr;
+		count--;
+	}
+	return current;
+}
+
+bool SchedulingHeap::remove(scheduling_s *scheduling) {
+	if (scheduling == root) {
+		return pop() != nullptr;
+	}
+
+	scheduling_s *prev = scheduling->prevScheduling_s;
+	if (!prev) {
+		// not root and not linked to anything - not in this heap
+		return false;
+	}
+
+	// cut the subtree out of its parent or sibling list
+	if (prev->childScheduling_s == scheduling) {
+		prev->childScheduling_s = scheduling->nextScheduling_s;
+	} else {
+		prev->nextScheduling_s = scheduling->nextScheduling_s;
+	}
+	if (scheduling->nextScheduling_s) {
+		scheduling->nextScheduling_s->prevScheduling_s = prev;
+	}
+	scheduling->nextScheduling_s = nullptr;
+	scheduling->prevScheduling_s = nullptr;
+
+	// children of the removed element go back into the heap
+	scheduling_s *orphans = mergePairs(scheduling->childScheduling_s);
+	scheduling->childScheduling_s = nullptr;
+	root = meld(root, orphans);
+	count--;
+	return true;
+}
+
+/**
+ * Pre-order walk without recursion or extra memory
+ */
+template<typename TFunc>
+void SchedulingHeap::forEach(TFunc func) const {
+	scheduling_s *node = root;
+	while (node) {
+		func(node);
+		if (node->childScheduling_s) {
+			node = node->childScheduling_s;
+			continue;
+		}
+		// climb up until we find an unvisited sibling
+		while (node && !node->nextScheduling_s) {
+			// walk to the leftmost sibling, its 'prev' is the parent
+			while (node->prevScheduling_s && node->prevScheduling_s->childScheduling_s != node) {
+				node = node->prevScheduling_s;
+			}
+			node = node->prevScheduling_s;
+		}
+		if (node) {
+			node = node->nextScheduling_s;
+		}
+	}
+}
+
+static bool isBefore(const scheduling_s *a, const scheduling_s *b) {
+	if (a->momentX != b->momentX) {
+		return a->momentX < b->momentX;
+	}
+	// any stable order would do for equal timestamps
+	return (uintptr_t)a < (uintptr_t)b;
+}
+
+scheduling_s *SchedulingHeap::getElementAtIndexForUnitText(int index) const {
+	scheduling_s *previous = nullptr;
+
+	for (int i = 0; i <= index; i++) {
+		// find smallest element which is after 'previous'
+		scheduling_s *best = nullptr;
+		forEach([&](scheduling_s *node) {
+			if (previous && !isBefore(previous, node)) {
+				return;
+			}
+			if (!best || isBefore(node, best)) {
+				best = node;
+			}
+		});
+
+		if (!best) {
+			return nullptr;
+		}
+		previous = best;
+	}
+
+	return previous;
+}
+
+void SchedulingHeap::assertIsSorted() const {
+	int counter = 0;
+	forEach([&](scheduling_s *node) {
+		counter++;
+		for (scheduling_s *child = node->childScheduling_s; child; child = child->nextScheduling_s) {
+			efiAssertVoid(ObdCode::CUSTOM_ERR_6623, node->momentX <= child->momentX, "heap order");
+		}
+	});
+	efiAssertVoid(ObdCode::CUSTOM_ERR_6623, counter == count, "heap size");
+}
+
+#endif /* EFI_EVENT_QUEUE_HEAP || EFI_UNIT_TEST */
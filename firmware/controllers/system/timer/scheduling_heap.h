@@ -0,0 +1,52 @@
+/**
+ * @file scheduling_heap.h
+ *
+ * Intrusive pairing heap of scheduling_s, EventQueue storage for EFI_EVENT_QUEUE_HEAP
+ *
+ * O(1) insert, amortized O(log size) remove and pop, O(1) access to the soonest element.
+ * Unlike SchedulingList, order of elements with equal timestamps is not preserved.
+ *
+ * this data structure is NOT thread safe
+ */
+
+#pragma once
+
+#include "scheduler.h"
+
+#if EFI_EVENT_QUEUE_HEAP || EFI_UNIT_TEST
+
+class SchedulingHeap {
+public:
+	/**
+	 * O(1)
+	 * @return true if inserted element is the new soonest element
+	 */
+	bool insert(scheduling_s *scheduling);
+	/**
+	 * amortized O(log size)
+	 * @return false if element was not found
+	 */
+	bool remove(scheduling_s *scheduling);
+
+	scheduling_s * top() const {
+		return root;
+	}
+	scheduling_s * pop();
+
+	int size() const {
+		return count;
+	}
+	/**
+	 * O(size * index), for unit tests only
+	 */
+	scheduling_s *getElementAtIndexForUnitText(int index) const;
+	void assertIsSorted() const;
+private:
+	template<typename TFunc>
+	void forEach(TFunc func) const;
+
+	scheduling_s *root = nullptr;
+	int count = 0;
+};
+
+#endif /* EFI_EVENT_QUEUE_HEAP || EFI_UNIT_TEST */
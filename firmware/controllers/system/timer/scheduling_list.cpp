@@ -0,0 +1,103 @@
+/**
+ * @file scheduling_list.cpp
+ *
+ * Implemented as a linked list, which is fine since the number of
+ * pending events is pretty low, see scheduling_heap.cpp for large queues
+ */
+
+#include "pch.h"
+
+#include "scheduling_list.h"
+#include "utlist.h"
+
+bool SchedulingList::insert(scheduling_s *scheduling) {
+	efitick_t timeX = scheduling->momentX;
+
+	if (head == NULL || timeX < head->momentX) {
+		// here we insert into head of the linked list
+		LL_PREPEND2(head, scheduling, nextScheduling_s);
+		return true;
+	}
+
+	// here we know we are not in the head of the list, let's find the position - linear search
+	scheduling_s *insertPosition = head;
+	while (insertPosition->nextScheduling_s != NULL && insertPosition->nextScheduling_s->momentX < timeX) {
+		insertPosition = insertPosition->nextScheduling_s;
+	}
+
+	scheduling->nextScheduling_s = insertPosition->nextScheduling_s;
+	insertPosition->nextScheduling_s = scheduling;
+	return false;
+}
+
+bool SchedulingList::remove(scheduling_s *scheduling) {
+	// Special case: empty list, nothing to do
+	if (!head) {
+		return false;
+	}
+
+	// Special case: is the item to remove at the head?
+	if (scheduling == head) {
+		head = head->nextScheduling_s;
+		scheduling->nextScheduling_s = nullptr;
+		return true;
+	}
+
+	auto prev = head;	// keep track of the element before the one to remove, so we can link around it
+	auto current = prev->nextScheduling_s;
+
+	// Find our element
+	while (current && current != scheduling) {
+		prev = current;
+		current = current->nextScheduling_s;
+	}
+
+	// Walked off the end
+	if (!current) {
+		return false;
+	}
+
+	// Link around the removed item
+	prev->nextScheduling_s = current->nextScheduling_s;
+	current->nextScheduling_s = nullptr;
+	return true;
+}
+
+scheduling_s * SchedulingList::pop() {
+	scheduling_s *current = head;
+	if (current) {
+		// step the head forward, unlink this element
+		head = current->nextScheduling_s;
+		current->nextScheduling_s = nullptr;
+	}
+	return current;
+}
+
+int SchedulingList::size() const {
+	scheduling_s *tmp;
+	int result;
+	LL_COUNT2(head, tmp, result, nextScheduling_s);
+	return result;
+}
+
+void SchedulingList::assertIsSorted() const {
+	scheduling_s *current = head;
+	while (current != NULL && current->nextScheduling_s != NULL) {
+		efiAssertVoid(ObdCode::CUSTOM_ERR_6623, current->momentX <= current->nextScheduling_s->momentX, "list order");
+		current = current->nextScheduling_s;
+	}
+}
+
+// todo: reduce code duplication with another 'getElementAtIndexForUnitText'
+scheduling_s *SchedulingList::getElementAtIndexForUnitText(int index) const {
+	scheduling_s * current;
+
+	LL_FOREACH2(head, current, nextScheduling_s)
+	{
+		if (index == 0)
+			return current;
+		index--;
+	}
+
+	return NULL;
+}
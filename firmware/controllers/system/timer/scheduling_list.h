@@ -0,0 +1,41 @@
+/**
+ * @file scheduling_list.h
+ *
+ * Sorted intrusive linked list of scheduling_s, historic EventQueue storage.
+ *
+ * O(size) insert and remove, O(1) access to the soonest element.
+ *
+ * this data structure is NOT thread safe
+ */
+
+#pragma once
+
+#include "scheduler.h"
+
+class SchedulingList {
+public:
+	/**
+	 * O(size) - linear search in sorted linked list
+	 * @return true if inserted into the head of the list
+	 */
+	bool insert(scheduling_s *scheduling);
+	/**
+	 * O(size) - linear search in sorted linked list
+	 * @return false if element was not found
+	 */
+	bool remove(scheduling_s *scheduling);
+
+	scheduling_s * top() const {
+		return head;
+	}
+	scheduling_s * pop();
+
+	int size() const;
+	scheduling_s *getElementAtIndexForUnitText(int index) const;
+	void assertIsSorted() const;
+private:
+	/**
+	 * this list is sorted
+	 */
+	scheduling_s *head = nullptr;
+};
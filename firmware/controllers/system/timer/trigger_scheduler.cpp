@@ -2,10 +2,6 @@
 
 #include "event_queue.h"
 
-bool TriggerScheduler::assertNotInList(AngleBasedEvent *head, AngleBasedEvent *element) {
-       assertNotInListMethodBody(head, element, nextToothEvent)
-}
-
 void TriggerScheduler::schedule(const char *msg, AngleBasedEvent* event, angle_t angle, action_s action) {
 	event->setAngle(angle);
 
@@ -44,6 +40,45 @@ bool TriggerScheduler::scheduleOrQueue(const char *msg, AngleBasedEvent *event,
 	}
 }
 
+bool TriggerScheduler::scheduleOrQueue(const char *msg, AngleBasedEvent *event, angle_t angle, action_s action) {
+	bool hasToothAnchor;
+	efitick_t edgeTimestamp;
+	float currentPhase;
+	float nextPhase;
+
+	{
+		chibios_rt::CriticalSectionLocker csl;
+
+		hasToothAnchor = m_hasToothAnchor;
+		edgeTimestamp = m_anchorTimestamp;
+		currentPhase = m_anchorPhase;
+		nextPhase = m_anchorNextPhase;
+	}
+
+	event->setAngle(angle);
+
+	// engine not running means nothing to anchor to, first tooth window containing 'angle' would pick it up
+	if (hasToothAnchor && isValidRpm(Sensor::getOrZero(SensorType::Rpm))
+			&& event->shouldSchedule(currentPhase, nextPhase)) {
+		float angleFromTooth = event->getAngleFromNow(currentPhase);
+		efitick_t eventTime = edgeTimestamp + USF2NT(engine->rpmCalculator.oneDegreeUs * angleFromTooth);
+		efitick_t nowNt = getTimeNowNt();
+
+		if (eventTime > nowNt) {
+			scheduleByAngle(&event->scheduling, edgeTimestamp, angleFromTooth, action);
+		} else {
+			// unlike tooth handlers we might be invoked after the crank has already passed 'angle' within
+			// current window, for instance short MAP sampling window or timer latency. Queue would only
+			// pick it up a whole engine cycle later so we are as close as we can get by firing right now.
+			engine->executor.scheduleByTimestampNt(msg, &event->scheduling, nowNt, action);
+		}
+		return true;
+	}
+
+	schedule(msg, event, action);
+	return false;
+}
+
 void TriggerScheduler::schedule(const char *msg, AngleBasedEvent* event, action_s action) {
 	if (event->enginePhase < 0) {
 	    // at the moment we expect API consumer to wrap angle. shall we do the wrapping in the enginePhase setter?
@@ -56,15 +91,52 @@ void TriggerScheduler::schedule(const char *msg, AngleBasedEvent* event, action_
 	{
 		chibios_rt::CriticalSectionLocker csl;
 
-		// TODO: This is O(n), consider some other way of detecting if in a list,
-		// and consider doubly linked or other list tricks.
+		if (event->phaseBucket >= 0) {
+			/**
+			 * for example, this might happen in case of sudden RPM change if event
+			 * was not scheduled by angle but was scheduled by time. In case of scheduling
+			 * by time with slow RPM the whole next fast revolution might be within the wait period
+			 */
+			warning(ObdCode::CUSTOM_RE_ADDING_INTO_EXECUTION_QUEUE, "re-adding element into event_queue");
+			relocate(event);
+			return;
+		}
+
+		// Use Append to retain some semblance of event ordering in case of
+		// time skew.  Thus on events are always followed by off events.
+		int bucket = getPhaseBucket(event->enginePhase);
+		LL_APPEND2(m_angleBasedEvents[bucket], event, nextToothEvent);
+		event->phaseBucket = bucket;
+	}
+}
 
-		if (!assertNotInList(m_angleBasedEventsHead, event)) {
-			// Use Append to retain some semblance of event ordering in case of
-			// time skew.  Thus on events are always followed by off events.
-			LL_APPEND2(m_angleBasedEventsHead, event, nextToothEvent);
+/**
+ * Moves queued event into the bucket matching its current angle right away: an event moved to an earlier
+ * angle would otherwise wait for the crank to reach the old bucket, that's a whole engine cycle late.
+ * Invoked under lock.
+ */
+void TriggerScheduler::relocate(AngleBasedEvent *event) {
+	int newBucket = getPhaseBucket(event->enginePhase);
+	if (newBucket == event->phaseBucket) {
+		return;
+	}
+
+	AngleBasedEvent *current;
+	LL_FOREACH2(m_angleBasedEvents[event->phaseBucket], current, nextToothEvent) {
+		if (current == event) {
+			break;
 		}
 	}
+
+	if (current == nullptr) {
+		// bucket is being processed by scheduleEventsInBucket right now, that one would relocate the event
+		return;
+	}
+
+	LL_DELETE2(m_angleBasedEvents[event->phaseBucket], event, nextToothEvent);
+	event->nextToothEvent = nullptr;
+	LL_APPEND2(m_angleBasedEvents[newBucket], event, nextToothEvent);
+	event->phaseBucket = newBucket;
 }
 
 void TriggerScheduler::scheduleEventsUntilNextTriggerTooth(int rpm,
@@ -75,14 +147,29 @@ void TriggerScheduler::scheduleEventsUntilNextTriggerTooth(int rpm,
 		return;
 	}
 
+	{
+		chibios_rt::CriticalSectionLocker csl;
+
+		m_hasToothAnchor = true;
+		m_anchorTimestamp = edgeTimestamp;
+		m_anchorPhase = currentPhase;
+		m_anchorNextPhase = nextPhase;
+	}
+
+	forEachPhaseBucket(currentPhase, nextPhase, [&](int bucket) {
+		scheduleEventsInBucket(bucket, edgeTimestamp, currentPhase, nextPhase);
+	});
+}
+
+void TriggerScheduler::scheduleEventsInBucket(int bucket, efitick_t edgeTimestamp, float currentPhase, float nextPhase) {
 	AngleBasedEvent *current, *tmp, *keephead;
 	AngleBasedEvent *keeptail = nullptr;
 
 	{
 		chibios_rt::CriticalSectionLocker csl;
 
-		keephead = m_angleBasedEventsHead;
-		m_angleBasedEventsHead = nullptr;
+		keephead = m_angleBasedEvents[bucket];
+		m_angleBasedEvents[bucket] = nullptr;
 	}
 
 	LL_FOREACH_SAFE2(keephead, current, tmp, nextToothEvent)
@@ -90,14 +177,11 @@ void TriggerScheduler::scheduleEventsUntilNextTriggerTooth(int rpm,
 		if (current->shouldSchedule(currentPhase, nextPhase)) {
 			// time to fire a spark which was scheduled previously
 
-			// Yes this looks like O(n^2), but that's only over the entire engine
-			// cycle.  It's really O(mn + nn) where m = # of teeth and n = # events
-			// fired per cycle.  The number of teeth outweigh the number of events, at
-			// least for 60-2....  So odds are we're only firing an event or two per
-			// tooth, which means the outer loop is really only O(n).  And if we are
-			// firing many events per teeth, then it's likely the events before this
-			// one also fired and thus the call to LL_DELETE2 is closer to O(1).
+			// Bucket only holds events close to each other so the odds are
+			// we're deleting from the head and LL_DELETE2 is O(1).
 			LL_DELETE2(keephead, current, nextToothEvent);
+			current->nextToothEvent = nullptr;
+			current->phaseBucket = -1;
 
 			scheduling_s * sDown = &current->scheduling;
 
@@ -116,6 +200,15 @@ void TriggerScheduler::scheduleEventsUntilNextTriggerTooth(int rpm,
 				current->getAngleFromNow(currentPhase),
 				current->action
 			);
+		} else if (getPhaseBucket(current->enginePhase) != bucket) {
+			// angle was changed while the event was queued, move it where it belongs
+			LL_DELETE2(keephead, current, nextToothEvent);
+			current->nextToothEvent = nullptr;
+
+			chibios_rt::CriticalSectionLocker csl;
+			int newBucket = getPhaseBucket(current->enginePhase);
+			LL_APPEND2(m_angleBasedEvents[newBucket], current, nextToothEvent);
+			current->phaseBucket = newBucket;
 		} else {
 			keeptail = current; // Used for fast list concatenation
 		}
@@ -125,8 +218,8 @@ void TriggerScheduler::scheduleEventsUntilNextTriggerTooth(int rpm,
 		chibios_rt::CriticalSectionLocker csl;
 
 		// Put any new entries onto the end of the keep list
-		keeptail->nextToothEvent = m_angleBasedEventsHead;
-		m_angleBasedEventsHead = keephead;
+		keeptail->nextToothEvent = m_angleBasedEvents[bucket];
+		m_angleBasedEvents[bucket] = keephead;
 	}
 }
 
@@ -144,15 +237,19 @@ float AngleBasedEvent::getAngleFromNow(float currentPhase) const {
 }
 
 #if EFI_UNIT_TEST
-// todo: reduce code duplication with another 'getElementAtIndexForUnitText'
+/**
+ * Pending events in engine phase order of buckets, in insertion order within a bucket
+ */
 AngleBasedEvent * TriggerScheduler::getElementAtIndexForUnitTest(int index) {
 	AngleBasedEvent * current;
 
-	LL_FOREACH2(m_angleBasedEventsHead, current, nextToothEvent)
-	{
-		if (index == 0)
-			return current;
-		index--;
+	for (int bucket = 0; bucket < PHASE_BUCKET_COUNT; bucket++) {
+		LL_FOREACH2(m_angleBasedEvents[bucket], current, nextToothEvent)
+		{
+			if (index == 0)
+				return current;
+			index--;
+		}
 	}
 	criticalError("getElementAtIndexForUnitText: null");
 	return nullptr;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "phase_buckets.h"
+
 // TriggerScheduler here is an intermediate tooth-based scheduler working on top of time-base scheduler
 // *kludge*: individual event for *Trigger*Scheduler is called *Angle*BasedEvent. Shall we rename to ToothSchedule and ToothBasedEvent?
 class TriggerScheduler : public EngineModule {
@@ -15,6 +17,16 @@ public:
 			     action_s action,
 				 float currentPhase, float nextPhase);
 
+	/**
+	 * Same as above for modules which are not invoked on trigger teeth: the most recent tooth is the anchor.
+	 * Only the remainder of current tooth window is ever converted to time so the wait does not
+	 * get longer and less accurate as RPM changes, and no timer is reprogrammed for far-future events.
+	 * Safe to invoke from any context including other scheduled actions. An angle which the crank has
+	 * already passed within current tooth window fires right away, an action re-arming itself for
+	 * next cycle should use 'schedule' instead.
+	 */
+	bool scheduleOrQueue(const char *msg, AngleBasedEvent *event, angle_t angle, action_s action);
+
     // scheduleForActualTimeBasedExecution using underlying time-base scheduler
 	void scheduleEventsUntilNextTriggerTooth(int rpm,
 						 efitick_t edgeTimestamp,
@@ -26,14 +38,19 @@ public:
 
 private:
 	void schedule(const char *msg, AngleBasedEvent* event, action_s action);
-
-	bool assertNotInList(AngleBasedEvent *head, AngleBasedEvent *element);
+	void relocate(AngleBasedEvent *event);
+	void scheduleEventsInBucket(int bucket, efitick_t edgeTimestamp, float currentPhase, float nextPhase);
 
 	/**
-	 * That's the linked list of pending events scheduled in relation to trigger
-	 * At the moment we iterate over the whole list while looking for events for specific
-	 * trigger index We can make it an array of lists per trigger index, but that would take
-	 * some RAM and probably not needed yet.
+	 * Pending events are kept in linked lists, one per phase bucket, so that
+	 * each tooth only looks at events which could be due between this tooth and the next.
+	 * See phase_buckets.h
 	 */
-	AngleBasedEvent *m_angleBasedEventsHead = nullptr;
+	AngleBasedEvent *m_angleBasedEvents[PHASE_BUCKET_COUNT] = {};
+
+	// most recent tooth processed by scheduleEventsUntilNextTriggerTooth
+	bool m_hasToothAnchor = false;
+	efitick_t m_anchorTimestamp = 0;
+	float m_anchorPhase = 0;
+	float m_anchorNextPhase = 0;
 };
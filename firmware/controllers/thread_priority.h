@@ -26,6 +26,9 @@
 // Logging buffer flush is *slightly* above PRIO_CONSOLE so that we don't starve logging buffers during initialization and console commands
 #define PRIO_TEXT_LOG (NORMALPRIO + 4)
 
+// SD log sampling only copies to RAM, the card is written from PRIO_MMC
+#define PRIO_MMC_SAMPLER (NORMALPRIO + 4)
+
 #define TCPIP_THREAD_PRIO (NORMALPRIO + 3)
 #define LWIP_THREAD_PRIORITY (NORMALPRIO + 2)
 
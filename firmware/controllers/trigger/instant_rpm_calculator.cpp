@@ -17,6 +17,7 @@ InstantRpmCalculator::InstantRpmCalculator() :
 			//https://en.cppreference.com/w/cpp/language/zero_initialization
 			timeOfLastEvent()
 			, instantRpmValue()
+			, instantRpmWindowMiddle()
 	{
 }
 
@@ -87,6 +88,8 @@ float InstantRpmCalculator::calculateInstantRpm(
 	float instantRpm = (60000000.0 / 360 * US_TO_NT_MULTIPLIER) * angleDiff / time;
 	assertIsInBoundsWithResult(current_index, instantRpmValue, "instantRpmValue", 0);
 	instantRpmValue[current_index] = instantRpm;
+	uint32_t windowMiddle = (uint32_t)nowNt - time / 2;
+	instantRpmWindowMiddle[current_index] = windowMiddle;
 
 	// This fixes early RPM instability based on incomplete data
 	if (instantRpm < RPM_LOW_THRESHOLD) {
@@ -97,9 +100,70 @@ float InstantRpmCalculator::calculateInstantRpm(
 
 	m_instantRpmRatio = instantRpm / instantRpmValue[prevIndex];
 
+	updateInstantRpmRate(instantRpm, windowMiddle, time, prevIndex, nowNt);
+
 	return instantRpm;
 }
 
+static constexpr float ntPerSecond = 1e6f * US_TO_NT_MULTIPLIER;
+
+void InstantRpmCalculator::updateInstantRpmRate(float instantRpm, uint32_t windowMiddle, uint32_t windowDuration,
+		uint32_t prevIndex, efitick_t nowNt) {
+	// window which ended at the tooth ~90 degrees ago
+	float prevRpm = instantRpmValue[prevIndex];
+	uint32_t middleDelta = windowMiddle - instantRpmWindowMiddle[prevIndex];
+
+	ToothEstimate estimate;
+	// neighbouring windows are about one window apart, anything else is left over from a previous engine cycle
+	if (prevRpm >= RPM_LOW_THRESHOLD && middleDelta > 0 && middleDelta < 2 * windowDuration) {
+		estimate.rpmRate = (instantRpm - prevRpm) * ntPerSecond / middleDelta;
+	}
+
+	estimate.rpm = instantRpm + estimate.rpmRate * (windowDuration / 2) / ntPerSecond;
+	estimate.timeNt = nowNt;
+
+	// readers may run in another thread or interrupt, they should never see half of an update
+	chibios_rt::CriticalSectionLocker csl;
+	m_toothEstimate = estimate;
+}
+
+InstantRpmCalculator::ToothEstimate InstantRpmCalculator::getToothEstimate() const {
+	chibios_rt::CriticalSectionLocker csl;
+	return m_toothEstimate;
+}
+
+floatus_t InstantRpmCalculator::getAngleToTimeUs(angle_t angle, efitick_t nowNt) const {
+	ToothEstimate estimate = getToothEstimate();
+	if (estimate.rpm < RPM_LOW_THRESHOLD) {
+		return NAN;
+	}
+
+	efitick_t sinceToothNt = nowNt - estimate.timeNt;
+	// no teeth for a while, estimate is not relevant anymore
+	if (sinceToothNt > MS2NT(1000) || sinceToothNt < -MS2NT(1000)) {
+		return NAN;
+	}
+
+	// 32 bit to float is cheap, see calculateInstantRpm
+	float sinceToothSeconds = (int32_t)sinceToothNt / ntPerSecond;
+
+	// degrees per second and degrees per second squared
+	float speed = (estimate.rpm + estimate.rpmRate * sinceToothSeconds) * 6;
+	float acceleration = estimate.rpmRate * 6;
+	if (speed <= 0) {
+		return NAN;
+	}
+
+	// angle = speed * t + acceleration * t^2 / 2 solved for t, in a form which is fine with zero acceleration
+	float discriminant = speed * speed + 2 * acceleration * angle;
+	if (discriminant <= 0) {
+		// decelerating too hard to ever get there according to the model, fall back to current speed
+		return 1e6f * angle / speed;
+	}
+
+	return 1e6f * 2 * angle / (speed + sqrtf(discriminant));
+}
+
 void InstantRpmCalculator::setLastEventTimeForInstantRpm(efitick_t nowNt) {
 	// here we remember tooth timestamps which happen prior to synchronization
 	if (spinningEventIndex >= efi::size(spinningEvents)) {
@@ -26,12 +26,39 @@ public:
 
 	void movePreSynchTimestamps();
 
+	struct ToothEstimate {
+		// RPM at the most recent tooth, extrapolated from the middle of the window
+		float rpm = 0;
+		/**
+		 * RPM change per second, estimated from instant RPM values ~90 degrees apart
+		 */
+		float rpmRate = 0;
+		efitick_t timeNt = 0;
+	};
+
+	/**
+	 * Estimate is updated by the trigger handler, this copy is consistent from any context
+	 */
+	ToothEstimate getToothEstimate() const;
+
+	float getInstantRpmRate() const {
+		return getToothEstimate().rpmRate;
+	}
+
+	/**
+	 * Time it takes the crankshaft to turn 'angle' degrees starting at 'nowNt', assuming that
+	 * acceleration stays as estimated at the most recent tooth.
+	 * @return NAN if there is no recent estimate
+	 */
+	floatus_t getAngleToTimeUs(angle_t angle, efitick_t nowNt) const;
+
 	void resetInstantRpm() {
 		memset(timeOfLastEvent, 0, sizeof(timeOfLastEvent));
 		memset(spinningEvents, 0, sizeof(spinningEvents));
 		spinningEventIndex = 0;
 		prevInstantRpmValue = 0;
 		m_instantRpm = 0;
+		m_toothEstimate = {};
 	}
 
 	/**
@@ -48,6 +75,11 @@ public:
 	 * instant RPM calculated at this trigger wheel tooth
 	 */
 	float instantRpmValue[PWM_PHASE_MAX_COUNT];
+	/**
+	 * middle of the window used for instant RPM at each tooth: with constant acceleration that's
+	 * the moment when actual RPM was equal to the window average
+	 */
+	uint32_t instantRpmWindowMiddle[PWM_PHASE_MAX_COUNT];
 	/**
 	 * Stores last non-zero instant RPM value to fix early instability
 	 */
@@ -60,5 +92,10 @@ private:
 		TriggerWaveform const & triggerShape, TriggerFormDetails *triggerFormDetails,
 		uint32_t index, efitick_t nowNt);
 
+	void updateInstantRpmRate(float instantRpm, uint32_t windowMiddle, uint32_t windowDuration,
+		uint32_t prevIndex, efitick_t nowNt);
+
 	float m_instantRpmRatio = 0;
+
+	ToothEstimate m_toothEstimate;
 };
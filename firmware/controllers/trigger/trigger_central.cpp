@@ -814,12 +814,6 @@ void TriggerCentral::handleShaftSignal(trigger_event_e signal, efitick_t timesta
 		// Schedule the TDC mark
 		tdcMarkCallback(triggerIndexForListeners, timestamp);
 
-#if !EFI_UNIT_TEST
-#if EFI_MAP_AVERAGING
-		mapAveragingTriggerCallback(triggerIndexForListeners, timestamp);
-#endif /* EFI_MAP_AVERAGING */
-#endif /* EFI_UNIT_TEST */
-
 #if EFI_LOGIC_ANALYZER
 		waTriggerEventListener(signal, triggerIndexForListeners, timestamp);
 #endif
@@ -854,6 +848,12 @@ void TriggerCentral::handleShaftSignal(trigger_event_e signal, efitick_t timesta
 			engine->tpsAccelEnrichment.onEngineCycleTps();
 		}
 
+#if !EFI_UNIT_TEST
+#if EFI_MAP_AVERAGING
+		mapAveragingTriggerCallback(triggerIndexForListeners, timestamp, currentEngineDecodedPhase, nextPhase);
+#endif /* EFI_MAP_AVERAGING */
+#endif /* EFI_UNIT_TEST */
+
 		// Handle ignition and injection
 		mainTriggerCallback(triggerIndexForListeners, timestamp, currentEngineDecodedPhase, nextPhase);
 
@@ -0,0 +1,114 @@
+#include "global.h"
+#include "perf_trace.h"
+// was generated automatically by rusEFI tool  from perf_trace.h // by enum_to_string.jar tool on Sat Oct 17 05:12:40 UTC 2026
+// see also gen_config_and_enums.bat
+
+
+
+const char *getPE(PE value){
+switch(value) {
+case PE::AdcCallbackFast:
+  return "AdcCallbackFast";
+case PE::AdcConversionFast:
+  return "AdcConversionFast";
+case PE::AdcConversionSlow:
+  return "AdcConversionSlow";
+case PE::AdcProcessSlow:
+  return "AdcProcessSlow";
+case PE::AdcSubscriptionUpdateSubscribers:
+  return "AdcSubscriptionUpdateSubscribers";
+case PE::ContextSwitch:
+  return "ContextSwitch";
+case PE::DecodeTriggerEvent:
+  return "DecodeTriggerEvent";
+case PE::EnginePeriodicFastCallback:
+  return "EnginePeriodicFastCallback";
+case PE::EnginePeriodicSlowCallback:
+  return "EnginePeriodicSlowCallback";
+case PE::EngineSniffer:
+  return "EngineSniffer";
+case PE::EngineStatePeriodicFastCallback:
+  return "EngineStatePeriodicFastCallback";
+case PE::EventQueueExecuteAll:
+  return "EventQueueExecuteAll";
+case PE::EventQueueExecuteCallback:
+  return "EventQueueExecuteCallback";
+case PE::EventQueueInsertTask:
+  return "EventQueueInsertTask";
+case PE::GetBaseFuel:
+  return "GetBaseFuel";
+case PE::GetInjectionDuration:
+  return "GetInjectionDuration";
+case PE::GetRunningFuel:
+  return "GetRunningFuel";
+case PE::GetSpeedDensityFuel:
+  return "GetSpeedDensityFuel";
+case PE::GetTimeNowUs:
+  return "GetTimeNowUs";
+case PE::GetTpsEnrichment:
+  return "GetTpsEnrichment";
+case PE::GlobalLock:
+  return "GlobalLock";
+case PE::GlobalUnlock:
+  return "GlobalUnlock";
+case PE::HandleFuel:
+  return "HandleFuel";
+case PE::HandleShaftSignal:
+  return "HandleShaftSignal";
+case PE::Hip9011IntHoldCallback:
+  return "Hip9011IntHoldCallback";
+case PE::INVALID:
+  return "INVALID";
+case PE::ISR:
+  return "ISR";
+case PE::LogTriggerTooth:
+  return "LogTriggerTooth";
+case PE::LuaTickFunction:
+  return "LuaTickFunction";
+case PE::MainTriggerCallback:
+  return "MainTriggerCallback";
+case PE::MapAveragingTriggerCallback:
+  return "MapAveragingTriggerCallback";
+case PE::OnTriggerEventSparkLogic:
+  return "OnTriggerEventSparkLogic";
+case PE::OutputPinSetValue:
+  return "OutputPinSetValue";
+case PE::PeriodicControllerPeriodicTask:
+  return "PeriodicControllerPeriodicTask";
+case PE::PeriodicTimerControllerPeriodicTask:
+  return "PeriodicTimerControllerPeriodicTask";
+case PE::PrepareIgnitionSchedule:
+  return "PrepareIgnitionSchedule";
+case PE::PwmConfigStateChangeCallback:
+  return "PwmConfigStateChangeCallback";
+case PE::PwmGeneratorCallback:
+  return "PwmGeneratorCallback";
+case PE::ShaftPositionListeners:
+  return "ShaftPositionListeners";
+case PE::SingleTimerExecutorDoExecute:
+  return "SingleTimerExecutorDoExecute";
+case PE::SingleTimerExecutorScheduleByTimestamp:
+  return "SingleTimerExecutorScheduleByTimestamp";
+case PE::SingleTimerExecutorScheduleTimerCallback:
+  return "SingleTimerExecutorScheduleTimerCallback";
+case PE::SoftwareKnockProcess:
+  return "SoftwareKnockProcess";
+case PE::Temporary1:
+  return "Temporary1";
+case PE::Temporary2:
+  return "Temporary2";
+case PE::Temporary3:
+  return "Temporary3";
+case PE::Temporary4:
+  return "Temporary4";
+case PE::TunerStudioHandleCrcCommand:
+  return "TunerStudioHandleCrcCommand";
+case PE::Unused:
+  return "Unused";
+case PE::Unused1:
+  return "Unused1";
+case PE::WallFuelAdjust:
+  return "WallFuelAdjust";
+  }
+ return NULL;
+}
@@ -0,0 +1,10 @@
+// was generated automatically by rusEFI tool  from perf_trace.h // by enum_to_string.jar tool on Sat Oct 17 05:12:40 UTC 2026
+// see also gen_config_and_enums.bat
+
+
+
+#include "perf_trace.h"
+#pragma once
+#if __cplusplus
+const char *getPE(PE value);
+#endif //__cplusplus
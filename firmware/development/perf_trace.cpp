@@ -8,6 +8,13 @@
 
 #include "pch.h"
 
+#if !EFI_PROD_CODE
+#include "auto_generated_perf_trace.h"
+
+#include <chrono>
+#include <vector>
+#endif // EFI_PROD_CODE
+
 #ifndef ENABLE_PERF_TRACE
 #error ENABLE_PERF_TRACE must be defined!
 #endif
@@ -40,51 +47,228 @@ static size_t s_nextIdx = 0;
 
 static bool s_isTracing = false;
 
+/**
+ * Streaming mode: the same buffer is split into chunks which are filled in ring order
+ * while TunerStudio drains full ones. Once every chunk is waiting to be read new events
+ * are dropped and counted, so the host sees where the gaps are.
+ */
+#define TRACE_CHUNK_SIZE 1024
+#define TRACE_CHUNK_COUNT (BIG_BUFFER_SIZE / TRACE_CHUNK_SIZE)
+
+struct TraceChunkHeader
+{
+	uint16_t Sequence;
+	uint16_t EntryCount;
+	// total since stream start, as of the moment this chunk was closed
+	uint32_t DroppedEvents;
+};
+
+#define TRACE_CHUNK_LENGTH ((TRACE_CHUNK_SIZE - sizeof(TraceChunkHeader)) / sizeof(TraceEntry))
+
+struct TraceChunk
+{
+	TraceChunkHeader Header;
+	TraceEntry Entries[TRACE_CHUNK_LENGTH];
+};
+
+// the host parses this
+static_assert(sizeof(TraceChunkHeader) == 8);
+static_assert(sizeof(TraceChunk) == TRACE_CHUNK_SIZE);
+
+static bool s_isStreaming = false;
+// oldest chunk which was not read yet
+static size_t s_readChunk = 0;
+// chunks waiting to be read, the one after them is being filled unless all of them are full
+static size_t s_fullChunks = 0;
+static uint16_t s_chunkSequence = 0;
+static uint32_t s_droppedEvents = 0;
+
+static TraceChunk* getChunk(size_t index) {
+	return &s_traceBuffer.get<TraceChunk>()[index % TRACE_CHUNK_COUNT];
+}
+
 static void stopTrace() {
 	s_isTracing = false;
 	s_nextIdx = 0;
 }
 
-static void perfEventImpl(PE event, EPhase phase) {
+static void closeChunk() {
+	TraceChunk* chunk = getChunk(s_readChunk + s_fullChunks);
+	chunk->Header.Sequence = s_chunkSequence++;
+	chunk->Header.EntryCount = s_nextIdx;
+	chunk->Header.DroppedEvents = s_droppedEvents;
+
+	s_fullChunks++;
+	s_nextIdx = 0;
+}
+
+static void appendToStream(const TraceEntry& entry) {
+	if (s_fullChunks == TRACE_CHUNK_COUNT) {
+		// reader is too slow
+		s_droppedEvents++;
+		return;
+	}
+
+	getChunk(s_readChunk + s_fullChunks)->Entries[s_nextIdx++] = entry;
+	if (s_nextIdx == TRACE_CHUNK_LENGTH) {
+		closeChunk();
+	}
+}
+
 #if EFI_PROD_CODE
-	// Bail if we aren't allowed to trace
-	if constexpr (!ENABLE_PERF_TRACE) {
+class TraceLock {
+public:
+	TraceLock() : m_primask(__get_PRIMASK()) {
+		__disable_irq();
+	}
+
+	~TraceLock() {
+		// Restore previous interrupt state - don't restore if they weren't enabled
+		if (!m_primask) {
+			__enable_irq();
+		}
+	}
+
+private:
+	const uint32_t m_primask;
+};
+#else
+class TraceLock {
+public:
+	TraceLock() { }
+};
+#endif // EFI_PROD_CODE
+
+#if !EFI_PROD_CODE
+/**
+ * Host builds (unit tests, simulator): same instrumentation, recorded with a wall clock into memory
+ * and saved as chrome://tracing / Perfetto JSON. There is no target to stream to and no
+ * shortage of RAM, so nothing here shares the big buffer.
+ */
+
+// 16 bytes each, a few seconds of simulator or a full unit test run
+#define PERF_TRACE_HOST_MAX_ENTRIES (4 * 1024 * 1024)
+
+struct HostTraceEntry
+{
+	PE Event;
+	EPhase Phase;
+	uint8_t ThreadId;
+	uint64_t TimestampNs;
+};
+
+static std::vector<HostTraceEntry> s_hostTrace;
+static bool s_isHostTracing = false;
+static size_t s_hostDroppedEvents = 0;
+static std::chrono::steady_clock::time_point s_hostTraceStart;
+
+static void hostPerfEvent(PE event, EPhase phase) {
+	if (!s_isHostTracing) {
 		return;
 	}
-	
-	// Bail if we aren't tracing
-	if (!s_isTracing || !s_traceBuffer) {
+
+	if (s_hostTrace.size() >= PERF_TRACE_HOST_MAX_ENTRIES) {
+		s_hostDroppedEvents++;
 		return;
 	}
 
-	// todo: why doesn't getTimeNowLowerNt() work here?
-	// It returns 0 like we're in a unit test
-	uint32_t timestamp = port_rt_get_counter_value();
+	auto elapsed = std::chrono::steady_clock::now() - s_hostTraceStart;
 
-	size_t idx;
+	HostTraceEntry entry;
+	entry.Event = event;
+	entry.Phase = phase;
+#if EFI_SIMULATOR
+	entry.ThreadId = chThdGetSelfX()->threadId;
+#else
+	entry.ThreadId = 0;
+#endif // EFI_SIMULATOR
+	entry.TimestampNs = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
 
-	// Critical section: disable interrupts to reserve an index.
-	// We could lock, but this gets called a LOT - so locks could
-	// significantly alter the results of the measurement.
-	// In addition, if we want to trace lock/unlock events, we can't
-	// be locking ourselves from the trace functionality.
-	{
-		uint32_t prim = __get_PRIMASK();
-		__disable_irq();
+	s_hostTrace.push_back(entry);
+}
 
-		idx = s_nextIdx++;
-		if (s_nextIdx >= TRACE_BUFFER_LENGTH) {
-			stopTrace();
-		}
+void perfTraceHostStart() {
+	s_hostTrace.clear();
+	s_hostTrace.reserve(64 * 1024);
+	s_hostDroppedEvents = 0;
+	s_hostTraceStart = std::chrono::steady_clock::now();
+	s_isHostTracing = true;
+}
 
-		// Restore previous interrupt state - don't restore if they weren't enabled
-		if (!prim) {
-			__enable_irq();
-		}
+struct HostTraceState {
+	std::vector<HostTraceEntry> trace;
+	bool isTracing = false;
+	size_t droppedEvents = 0;
+	std::chrono::steady_clock::time_point start;
+};
+
+static HostTraceState s_savedHostTrace;
+
+void perfTraceHostSave() {
+	s_savedHostTrace.trace = std::move(s_hostTrace);
+	s_savedHostTrace.isTracing = s_isHostTracing;
+	s_savedHostTrace.droppedEvents = s_hostDroppedEvents;
+	s_savedHostTrace.start = s_hostTraceStart;
+
+	s_hostTrace = {};
+	s_isHostTracing = false;
+	s_hostDroppedEvents = 0;
+}
+
+void perfTraceHostRestore() {
+	s_hostTrace = std::move(s_savedHostTrace.trace);
+	s_isHostTracing = s_savedHostTrace.isTracing;
+	s_hostDroppedEvents = s_savedHostTrace.droppedEvents;
+	s_hostTraceStart = s_savedHostTrace.start;
+
+	s_savedHostTrace = {};
+}
+
+int perfTraceHostWriteJson(const char* fileName) {
+	s_isHostTracing = false;
+
+	FILE* fp = fopen(fileName, "w");
+	if (!fp) {
+		return -1;
 	}
 
-	// We can safely write data out of the lock, our spot is reserved
-	volatile TraceEntry& entry = s_traceBuffer.get<TraceEntry>()[idx];
+	fprintf(fp, "{\"traceEvents\": [\n");
+	fprintf(fp, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"%s\"}}",
+		EFI_SIMULATOR ? "rusEFI simulator" : "rusEFI unit tests");
+
+	for (const auto& entry : s_hostTrace) {
+		const char* ph = entry.Phase == EPhase::Start ? "B" : (entry.Phase == EPhase::End ? "E" : "i");
+		// global instants are drawn across all threads
+		const char* scope = entry.Phase == EPhase::InstantGlobal ? ",\"s\":\"g\"" : "";
+
+		fprintf(fp, ",\n{\"name\":\"%s\",\"ph\":\"%s\"%s,\"pid\":0,\"tid\":%d,\"ts\":%.3f}",
+			getPE(entry.Event), ph, scope, entry.ThreadId, entry.TimestampNs / 1000.0);
+	}
+
+	fprintf(fp, "\n]}\n");
+	fclose(fp);
+
+	if (s_hostDroppedEvents > 0) {
+		printf("perf trace: %d events dropped after %d\n", (int)s_hostDroppedEvents, PERF_TRACE_HOST_MAX_ENTRIES);
+	}
+
+	return s_hostTrace.size();
+}
+#endif // EFI_PROD_CODE
+
+static void perfEventImpl(PE event, EPhase phase) {
+#if EFI_PROD_CODE
+	// Bail if we aren't allowed to trace
+	if constexpr (!ENABLE_PERF_TRACE) {
+		return;
+	}
+	
+	// Bail if we aren't tracing
+	if ((!s_isTracing && !s_isStreaming) || !s_traceBuffer) {
+		return;
+	}
+
+	TraceEntry entry;
 
 	entry.Event = event;
 	entry.Phase = phase;
@@ -100,7 +284,37 @@ static void perfEventImpl(PE event, EPhase phase) {
 		entry.ThreadId = 0;
 	}
 
-	entry.Timestamp = timestamp;
+	// todo: why doesn't getTimeNowLowerNt() work here?
+	// It returns 0 like we're in a unit test
+	entry.Timestamp = port_rt_get_counter_value();
+
+	// Critical section: disable interrupts to reserve an index and copy the entry.
+	// We could lock, but this gets called a LOT - so locks could
+	// significantly alter the results of the measurement.
+	// In addition, if we want to trace lock/unlock events, we can't
+	// be locking ourselves from the trace functionality.
+	// The entry is copied under the same critical section so that a chunk is complete
+	// by the time it's handed over to the reader.
+	TraceLock lock;
+
+	if (s_isStreaming) {
+		appendToStream(entry);
+		return;
+	}
+
+	if (!s_isTracing) {
+		// buffer was filled by an interrupt while we were preparing the entry
+		return;
+	}
+
+	size_t idx = s_nextIdx++;
+	if (s_nextIdx >= TRACE_BUFFER_LENGTH) {
+		stopTrace();
+	}
+
+	s_traceBuffer.get<TraceEntry>()[idx] = entry;
+#else
+	hostPerfEvent(event, phase);
 #endif // EFI_PROD_CODE
 }
 
@@ -116,7 +330,22 @@ void perfEventInstantGlobal(PE event) {
 	perfEventImpl(event, EPhase::InstantGlobal);
 }
 
+static void releaseTraceBuffer() {
+	// move assignment would not give the buffer back, destructor does
+	BigBufferHandle released = efi::move(s_traceBuffer);
+}
+
+static void stopStream() {
+	s_isStreaming = false;
+	s_readChunk = 0;
+	s_fullChunks = 0;
+	s_nextIdx = 0;
+}
+
 void perfTraceEnable() {
+	stopStream();
+	// release whatever we have before asking for the buffer again
+	releaseTraceBuffer();
 	s_traceBuffer = getBigBuffer(BigBufferUser::PerfTrace);
 	s_isTracing = true;
 }
@@ -124,7 +353,61 @@ void perfTraceEnable() {
 const BigBufferHandle perfTraceGetBuffer() {
 	// stop tracing if you try to get the buffer early
 	stopTrace();
+	stopStream();
 
 	// transfer ownership of the buffer to the caller
 	return efi::move(s_traceBuffer);
 }
+
+void perfTraceStreamStart() {
+	stopTrace();
+	stopStream();
+	releaseTraceBuffer();
+	s_traceBuffer = getBigBuffer(BigBufferUser::PerfTrace);
+
+	s_chunkSequence = 0;
+	s_droppedEvents = 0;
+	s_isStreaming = true;
+}
+
+void perfTraceStreamStop() {
+	TraceLock lock;
+
+	if (!s_isStreaming) {
+		return;
+	}
+	s_isStreaming = false;
+
+	// partial chunk is still worth reading
+	if (s_nextIdx > 0 && s_fullChunks < TRACE_CHUNK_COUNT) {
+		closeChunk();
+	}
+}
+
+const uint8_t* perfTraceStreamGetChunk(size_t& size) {
+	if (!s_traceBuffer || s_fullChunks == 0) {
+		return nullptr;
+	}
+
+	// writers never touch full chunks, no lock needed to read one
+	TraceChunk* chunk = getChunk(s_readChunk);
+	size = sizeof(TraceChunkHeader) + chunk->Header.EntryCount * sizeof(TraceEntry);
+	return reinterpret_cast<const uint8_t*>(chunk);
+}
+
+void perfTraceStreamReleaseChunk() {
+	{
+		TraceLock lock;
+
+		if (s_fullChunks == 0) {
+			return;
+		}
+		s_readChunk = (s_readChunk + 1) % TRACE_CHUNK_COUNT;
+		s_fullChunks--;
+	}
+
+	if (!s_isStreaming && s_fullChunks == 0) {
+		// everything was drained, let tooth logger or trigger scope have the buffer
+		releaseTraceBuffer();
+	}
+}
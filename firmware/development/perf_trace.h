@@ -17,6 +17,7 @@
 // ended, or occurred.
 enum class PE : uint8_t {
 	// The tag below is consumed by PerfTraceTool.java which generates EnumNames.java
+	// getPE() for host side JSON comes from gen_enum_to_string.sh
 	// enum_start_tag
 	INVALID,
 	ISR,
@@ -84,6 +85,27 @@ void perfTraceEnable();
 // Retrieve the trace buffer
 const BigBufferHandle perfTraceGetBuffer();
 
+// Continuous tracing into a ring of chunks, which have to be read out faster than they fill up.
+// Holds the big buffer until stopped and fully drained.
+void perfTraceStreamStart();
+// Closes the partially filled chunk, chunks which are already full can still be read
+void perfTraceStreamStop();
+// Oldest full chunk: 8 byte header followed by entries, nullptr if none is ready yet
+const uint8_t* perfTraceStreamGetChunk(size_t& size);
+// Hand the chunk from perfTraceStreamGetChunk back to the writers
+void perfTraceStreamReleaseChunk();
+
+#if !EFI_PROD_CODE
+// Host builds record into memory with a wall clock, for profiling on a PC
+void perfTraceHostStart();
+// Stops recording and writes chrome://tracing / Perfetto JSON, returns number of events or -1 on error
+int perfTraceHostWriteJson(const char* fileName);
+// Set aside whatever is being recorded (RUSEFI_PERF_TRACE whole run capture) so that a test can
+// record on its own, and bring it back afterwards
+void perfTraceHostSave();
+void perfTraceHostRestore();
+#endif // EFI_PROD_CODE
+
 #if ENABLE_PERF_TRACE
 class ScopePerf
 {
@@ -77,6 +77,14 @@ java -DSystemOut.name=logs/gen_enum_to_string \
 
 [ $? -eq 0 ] || { echo "ERROR generating sensors"; exit 1; }
 
+java -DSystemOut.name=logs/gen_enum_to_string \
+	-jar ${ENUM_JAR} \
+	-outputPath development \
+	-generatedFile perf_trace \
+	-enumInputFile development/perf_trace.h
+
+[ $? -eq 0 ] || { echo "ERROR generating perf trace"; exit 1; }
+
 pwd
 cd config/boards/kinetis/config
 ./kinetis_gen_enum_to_string.sh
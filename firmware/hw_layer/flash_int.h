@@ -125,6 +125,13 @@ int intFlashSectorErase(flashsector_t sector);
  */
 int intFlashErase(flashaddr_t address, size_t size);
 
+/**
+ * @brief Get the end of the span erased by intFlashErase(@p address, @p size).
+ * @details Everything between @p address + @p size and the returned address is erased as well.
+ * @return Address right after the last erased sector.
+ */
+flashaddr_t intFlashEraseEnd(flashaddr_t address, size_t size);
+
 /**
  * @brief Check if the @p size bytes of flash memory starting at @p address are erased.
  * @note If the memory is erased, one can write data into it safely.
@@ -17,8 +17,11 @@
 #if EFI_FILE_LOGGING
 
 #include "buffered_writer.h"
+#include "record_ring_writer.h"
+#include "periodic_thread_controller.h"
 #include "status_loop.h"
 #include "binary_logging.h"
+#include "tooth_log_compact.h"
 
 static bool fs_ready = false;
 
@@ -27,6 +30,8 @@ static int fileCreatedCounter = 0;
 static int writeCounter = 0;
 static int totalWritesCounter = 0;
 static int totalSyncCounter = 0;
+// worst case time spent in a single file write
+static uint32_t maxWriteLatencyUs = 0;
 
 #if EFI_PROD_CODE
 
@@ -52,9 +57,13 @@ static int totalSyncCounter = 0;
 // todo: shall we migrate to enum with enum2string for consistency? maybe not until we start reading sdStatus?
 static const char *sdStatus = SD_STATE_INIT;
 
-// at about 20Hz we write about 2Kb per second, looks like we flush once every ~2 seconds
+// writes are SD_LOG_BLOCK_SIZE or more, so this is f_sync every ~5Kb
 #define F_SYNC_FREQUENCY 10
 
+#ifndef SD_LOG_PREALLOCATE_SIZE
+#define SD_LOG_PREALLOCATE_SIZE (64 * 1024 * 1024)
+#endif
+
 /**
  * on't re-read SD card spi device after boot - it could change mid transaction (TS thread could preempt),
  * which will cause disaster (usually multiple-unlock of the same mutex in UNLOCK_SD_SPI)
@@ -129,6 +138,7 @@ static void sdStatistics() {
 	printSpiConfig("SD", mmcSpiDevice);
 	if (isSdCardAlive()) {
 		efiPrintf("filename=%s size=%d", logName, totalLoggedBytes);
+		efiPrintf("dropped records=%d max write latency=%dus", (int)getSdLogDroppedRecords(), (int)maxWriteLatencyUs);
 	}
 }
 
@@ -184,7 +194,7 @@ static void prepareLogFileName() {
 	}
 
 	if (engineConfiguration->sdTriggerLog) {
-		strcat(ptr, ".teeth");
+		strcat(ptr, engineConfiguration->sdTriggerLogFormat == ToothLogFormat::Compact ? ".teethc" : ".teeth");
 	} else {
 		strcat(ptr, DOT_MLG);
 	}
@@ -215,6 +225,15 @@ static void createLogFile() {
 		printError("Seek error", err);
 		return;
 	}
+
+	if (f_size(&FDLogFile) == 0) {
+		// Ask for contiguous clusters up front so that cluster allocation does not stall writes later.
+		// Only a hint: without enough contiguous free space the file just grows as usual.
+		err = f_expand(&FDLogFile, SD_LOG_PREALLOCATE_SIZE, 0);
+		if (err != FR_OK) {
+			efiPrintf("SD: preallocate %d failed %d", SD_LOG_PREALLOCATE_SIZE, err);
+		}
+	}
 	f_sync(&FDLogFile);
 	setSdCardReady(true);						// everything Ok
 }
@@ -474,6 +493,30 @@ struct SdLogBufferWriter final : public BufferedWriter<512> {
 
 		return bytesWritten;
 	}
+
+	/**
+	 * Writes the block which is still being filled, then moves back to its start so that the
+	 * complete block replaces it later and writes stay block aligned
+	 */
+	void writeTail(const char* buffer, size_t count) {
+		FSIZE_t position = f_tell(&FDLogFile);
+		size_t bytesWritten;
+
+		FRESULT err = f_write(&FDLogFile, buffer, count, &bytesWritten);
+
+		if (bytesWritten != count) {
+			printError("write error or disk full", err);
+
+			// Close file and unmount volume
+			mmcUnMount();
+			failed = true;
+			return;
+		}
+
+		f_sync(&FDLogFile);
+		totalSyncCounter++;
+		f_lseek(&FDLogFile, position);
+	}
 };
 
 #else // not EFI_PROD_CODE (simulator)
@@ -501,6 +544,13 @@ public:
 		return count;
 	}
 
+	void writeTail(const char* buffer, size_t count) {
+		auto position = m_stream.tellp();
+		m_stream.write(buffer, count);
+		m_stream.flush();
+		m_stream.seekp(position);
+	}
+
 private:
 	std::ofstream m_stream;
 };
@@ -509,6 +559,65 @@ private:
 
 static NO_CACHE SdLogBufferWriter logBuffer;
 
+#ifndef SD_LOG_BLOCK_SIZE
+// one sector: f_write of whole sectors goes straight to the card without a copy
+#define SD_LOG_BLOCK_SIZE 512
+#endif
+
+#ifndef SD_LOG_BLOCK_COUNT
+#define SD_LOG_BLOCK_COUNT 16
+#endif
+
+// records waiting for the writer thread
+static NO_CACHE RecordRingWriter<SD_LOG_BLOCK_SIZE, SD_LOG_BLOCK_COUNT> logRing;
+
+#ifndef SD_LOG_TAIL_PERIOD_MS
+// longest time logged records sit in RAM while their block is not full yet
+#define SD_LOG_TAIL_PERIOD_MS 1000
+#endif
+
+extern bool main_loop_started;
+
+/**
+ * Takes a sample on a fixed schedule and only copies it into RAM, so that card latency
+ * does not move sample timestamps. Records are dropped if the writer falls too far behind.
+ *
+ * Sample period is a whole number of system ticks, 1ms on hardware: only rates which divide
+ * CH_CFG_ST_FREQUENCY are exact, others are rounded to the nearest tick (667hz and up all log at 1000hz).
+ *
+ * writeSdLogLine runs live data update and log line formatting, so stack is sized like
+ * the MMC thread which used to do that work.
+ */
+class MlgSampler : public PeriodicController<3 * UTILITY_THREAD_STACK_SIZE> {
+public:
+	MlgSampler() : PeriodicController("MMC Sampler", PRIO_MMC_SAMPLER, 20) {}
+
+	bool isEnabled = false;
+
+	void PeriodicTask(efitick_t) override {
+		float freq = clampF(1, engineConfiguration->sdCardLogFrequency, minF(1000, CH_CFG_ST_FREQUENCY));
+		setFrequency(freq);
+
+		if (!isEnabled) {
+			return;
+		}
+
+		logRing.beginRecord();
+		writeSdLogLine(logRing);
+		logRing.commitRecord();
+
+#if EFI_TUNER_STUDIO
+		engine->outputChannels.sdLogDroppedRecords = logRing.getDroppedRecords();
+#endif
+	}
+};
+
+static MlgSampler mlgSampler;
+
+uint32_t getSdLogDroppedRecords() {
+	return logRing.getDroppedRecords();
+}
+
 // Log 'regular' ECU log to MLG file
 static void mlgLogger();
 
@@ -536,33 +645,83 @@ static THD_FUNCTION(MMCmonThread, arg) {
 	}
 }
 
+static void writeLogTail() {
+	size_t size;
+	const char* tail = logRing.getPartialBlock(size);
+	if (tail) {
+		logBuffer.writeTail(tail, size);
+	}
+}
+
+/**
+ * Writer side: the header is written directly, after that whole blocks from logRing.
+ * A block which is not full yet is written every SD_LOG_TAIL_PERIOD_MS and when logging stops,
+ * and gets overwritten once it is complete.
+ */
 void mlgLogger() {
+	while (!main_loop_started) {
+		chThdSleepMilliseconds(10);
+	}
+
+	// header is padded so that records start on a block boundary of the file
+	writeFileHeader(logBuffer, SD_LOG_BLOCK_SIZE);
+	logBuffer.flush();
+	if (logBuffer.failed) {
+		return;
+	}
+
+	mlgSampler.isEnabled = true;
+	mlgSampler.start();
+
+	efitimems_t lastWriteMs = getTimeNowMs();
+
 	while (true) {
 		// if the SPI device got un-picked somehow, cancel SD card
 		// Don't do this check at all if using SDMMC interface instead of SPI
 #if EFI_PROD_CODE && !defined(EFI_SDC_DEVICE)
 		if (engineConfiguration->sdCardSpiDevice == SPI_NONE) {
+			mlgSampler.isEnabled = false;
+			writeLogTail();
 			return;
 		}
 #endif
 
+		size_t size;
+		const char* blocks = logRing.getFullBlocks(size);
+		if (!blocks) {
+			if (getTimeNowMs() - lastWriteMs >= SD_LOG_TAIL_PERIOD_MS) {
+				writeLogTail();
+				lastWriteMs = getTimeNowMs();
+
+				if (logBuffer.failed) {
+					mlgSampler.isEnabled = false;
+					return;
+				}
+			}
 
-		writeSdLogLine(logBuffer);
+			chThdSleepMilliseconds(5);
+			continue;
+		}
+
+		efitimeus_t startUs = getTimeNowUs();
+		// logBuffer is empty at this point so whole blocks go straight to writeInternal
+		logBuffer.write(blocks, size);
+		uint32_t latencyUs = getTimeNowUs() - startUs;
+		if (latencyUs > maxWriteLatencyUs) {
+			maxWriteLatencyUs = latencyUs;
+#if EFI_TUNER_STUDIO
+			engine->outputChannels.sdLogMaxWriteLatency = maxWriteLatencyUs;
+#endif
+		}
+
+		logRing.releaseBlocks(size);
+		lastWriteMs = getTimeNowMs();
 
 		// Something went wrong (already handled), so cancel further writes
 		if (logBuffer.failed) {
+			mlgSampler.isEnabled = false;
 			return;
 		}
-
-		auto freq = engineConfiguration->sdCardLogFrequency;
-		if (freq > 250) {
-			freq = 250;
-		} else if (freq < 1) {
-			freq = 1;
-		}
-
-		auto period = 1e6 / freq;
-		chThdSleepMicroseconds((int)period);
 	}
 }
 
@@ -575,7 +734,11 @@ static void sdTriggerLogger() {
 
 		// can return nullptr
 		if (buffer) {
-			logBuffer.write(reinterpret_cast<const char*>(buffer->buffer), buffer->nextIdx * sizeof(composite_logger_s));
+			if (engineConfiguration->sdTriggerLogFormat == ToothLogFormat::Compact) {
+				writeToothLogCompact(logBuffer, buffer->buffer, buffer->nextIdx);
+			} else {
+				logBuffer.write(reinterpret_cast<const char*>(buffer->buffer), buffer->nextIdx * sizeof(composite_logger_s));
+			}
 
 			ReturnToothLoggerBuffer(buffer);
 		}
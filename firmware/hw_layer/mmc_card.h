@@ -16,6 +16,8 @@
 void initEarlyMmcCard();
 void initMmcCard();
 bool isSdCardAlive(void);
+// records which did not fit into RAM while the card was busy
+uint32_t getSdLogDroppedRecords();
 
 void onUsbConnectedNotifyMmcI(void);
 
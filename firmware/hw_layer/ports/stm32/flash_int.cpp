@@ -215,6 +215,20 @@ int intFlashErase(flashaddr_t address, size_t size) {
 	return FLASH_RETURN_SUCCESS;
 }
 
+flashaddr_t intFlashEraseEnd(flashaddr_t address, size_t size) {
+	// same walk as intFlashErase
+	while (size > 0) {
+		flashsector_t sector = intFlashSectorAt(address);
+		address = intFlashSectorEnd(sector);
+		size_t sector_size = flashSectorSize(sector);
+		if (sector_size >= size)
+			break;
+		size -= sector_size;
+	}
+
+	return address;
+}
+
 bool intFlashIsErased(flashaddr_t address, size_t size) {
 #if CORTEX_MODEL == 7
 	// If we have a cache, invalidate the relevant cache lines.
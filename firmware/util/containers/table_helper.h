@@ -22,6 +22,126 @@ public:
 	virtual float getValue(float xColumn, float yRow) const = 0;
 };
 
+/**
+ * Position of a value on a table axis: lower bin and how far we are towards the next one.
+ * Clamped to the first/last bin same as interpolate3d.
+ */
+struct AxisBin {
+	size_t idx;
+	float frac;
+};
+
+template<typename TBin, int TSize>
+AxisBin findAxisBin(const TBin (&bins)[TSize], float value) {
+	static_assert(TSize >= 2, "axis needs at least two bins");
+
+	// NaN is treated same as off-scale low
+	if (!(value > bins[0])) {
+		return { 0, 0 };
+	}
+
+	if (value >= bins[TSize - 1]) {
+		return { TSize - 2, 1 };
+	}
+
+	// bins[low] <= value < bins[high] all the way
+	size_t low = 0;
+	size_t high = TSize - 1;
+	while (high - low > 1) {
+		size_t middle = (low + high) / 2;
+		if (bins[middle] <= value) {
+			low = middle;
+		} else {
+			high = middle;
+		}
+	}
+
+	float lowValue = bins[low];
+	float highValue = bins[high];
+	return { low, (value - lowValue) / (highValue - lowValue) };
+}
+
+#define MAP3D_LOOKUP_AXIS_CACHE 4
+
+/**
+ * One set of table inputs, for example RPM and load of current fast callback.
+ * Tables which share the very same axis arrays (same address, not just same values) reuse bin search
+ * result instead of repeating it, per-cylinder trims being the obvious case. Short-lived by design:
+ * create one per tick on the stack, any config change between ticks is picked up by the next context.
+ */
+class Map3DLookupContext {
+public:
+	Map3DLookupContext(float xColumn, float yRow)
+		: xColumn(xColumn)
+		, yRow(yRow)
+	{
+	}
+
+	template<typename TBin, int TSize>
+	AxisBin getColumnBin(const TBin (&bins)[TSize]) {
+		return getBin(m_columns, m_columnCount, bins, xColumn);
+	}
+
+	template<typename TBin, int TSize>
+	AxisBin getRowBin(const TBin (&bins)[TSize]) {
+		return getBin(m_rows, m_rowCount, bins, yRow);
+	}
+
+	const float xColumn;
+	const float yRow;
+
+	// how many bin searches were avoided, for unit tests
+	int hitCount = 0;
+
+private:
+	struct Entry {
+		const void *bins;
+		AxisBin bin;
+	};
+
+	template<typename TBin, int TSize>
+	AxisBin getBin(Entry (&cache)[MAP3D_LOOKUP_AXIS_CACHE], int& count, const TBin (&bins)[TSize], float value) {
+		for (int i = 0; i < count; i++) {
+			if (cache[i].bins == &bins) {
+				hitCount++;
+				return cache[i].bin;
+			}
+		}
+
+		AxisBin result = findAxisBin(bins, value);
+		if (count < MAP3D_LOOKUP_AXIS_CACHE) {
+			cache[count++] = { &bins, result };
+		}
+		return result;
+	}
+
+	Entry m_columns[MAP3D_LOOKUP_AXIS_CACHE];
+	Entry m_rows[MAP3D_LOOKUP_AXIS_CACHE];
+	int m_columnCount = 0;
+	int m_rowCount = 0;
+};
+
+/**
+ * Same as interpolate3d(table, rowBins, context.yRow, colBins, context.xColumn) with axis bins
+ * shared across all tables looked up with this context
+ */
+template<typename TValue, int TRowNum, int TColNum, typename TRow, typename TColumn>
+float interpolate3d(Map3DLookupContext& context, const TValue (&table)[TRowNum][TColNum],
+		const TRow (&rowBins)[TRowNum], const TColumn (&colBins)[TColNum]) {
+	AxisBin row = context.getRowBin(rowBins);
+	AxisBin col = context.getColumnBin(colBins);
+
+	float lowerLeft = table[row.idx][col.idx];
+	float lowerRight = table[row.idx][col.idx + 1];
+	float upperLeft = table[row.idx + 1][col.idx];
+	float upperRight = table[row.idx + 1][col.idx + 1];
+
+	// same arithmetic as interpolate3d
+	float bottom = lowerRight * col.frac + lowerLeft * (1 - col.frac);
+	float top = upperRight * col.frac + upperLeft * (1 - col.frac);
+
+	return top * row.frac + bottom * (1 - row.frac);
+}
 
 /**
  * this helper class brings together 3D table with two 2D axis curves
@@ -65,6 +65,32 @@ float Biquad::filter(float input) {
 	return result;
 }
 
+float Biquad::filterSumSquares(const uint16_t *input, size_t count, float inputScale, float *lastOutput) {
+	// keep state in locals so that it stays in registers, and in raw units so that there is no per-sample scaling
+	float localZ1 = z1 / inputScale;
+	float localZ2 = z2 / inputScale;
+	float result = 0;
+	float sumSq = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		float x = input[i];
+		result = x * a0 + localZ1;
+		localZ1 = x * a1 + localZ2 - b1 * result;
+		localZ2 = x * a2 - b2 * result;
+
+		sumSq += result * result;
+	}
+
+	z1 = localZ1 * inputScale;
+	z2 = localZ2 * inputScale;
+
+	if (lastOutput) {
+		*lastOutput = result * inputScale;
+	}
+
+	return sumSq * inputScale * inputScale;
+}
+
 void Biquad::cookSteadyState(float steadyStateInput) {
     float Y = steadyStateInput * (a0 + a1 + a2) / (1 + b1 + b2);
 
@@ -12,6 +12,13 @@ public:
 	Biquad();
 
 	float filter(float input);
+	/**
+	 * Filters a whole block of raw samples, 'inputScale' converts them to the units filter state is kept in.
+	 * Filter is linear so scale is applied once per block rather than per sample.
+	 * @param lastOutput optional, receives scaled output for the last sample
+	 * @return sum of squares of scaled filter output
+	 */
+	float filterSumSquares(const uint16_t *input, size_t count, float inputScale, float *lastOutput = nullptr);
 	void reset();
 	void cookSteadyState(float steadyStateInput);
 
@@ -0,0 +1,48 @@
+/*
+ * @file goertzel.cpp
+ *
+ * See https://en.wikipedia.org/wiki/Goertzel_algorithm
+ */
+
+#include "pch.h"
+
+#include "goertzel.h"
+
+void GoertzelBank::configure(float samplingFrequency, const float *frequencies, size_t count) {
+	m_count = 0;
+
+	for (size_t i = 0; i < count && m_count < GOERTZEL_MAX_BANDS; i++) {
+		if (frequencies[i] <= 0) {
+			continue;
+		}
+
+		criticalAssertVoid(samplingFrequency >= 2.5f * frequencies[i], "Invalid goertzel parameters");
+
+		m_coefficients[m_count] = 2 * cosf(2 * CONST_PI * frequencies[i] / samplingFrequency);
+		m_count++;
+	}
+}
+
+void GoertzelBank::process(const uint16_t *input, size_t count, float bias, float inputScale, float *meanSquares) const {
+	float s1[GOERTZEL_MAX_BANDS] = {};
+	float s2[GOERTZEL_MAX_BANDS] = {};
+
+	// one pass over the samples for all bands, each sample is read once
+	for (size_t i = 0; i < count; i++) {
+		float x = input[i] - bias;
+
+		for (size_t band = 0; band < m_count; band++) {
+			float s0 = x + m_coefficients[band] * s1[band] - s2[band];
+			s2[band] = s1[band];
+			s1[band] = s0;
+		}
+	}
+
+	// |X(f)|^2 is N^2 * A^2 / 4 for a sine of amplitude A, while its mean square is A^2 / 2
+	float norm = 2 * inputScale * inputScale / ((float)count * count);
+
+	for (size_t band = 0; band < m_count; band++) {
+		float power = s1[band] * s1[band] + s2[band] * s2[band] - m_coefficients[band] * s1[band] * s2[band];
+		meanSquares[band] = power * norm;
+	}
+}
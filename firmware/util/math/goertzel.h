@@ -0,0 +1,33 @@
+/*
+ * @file goertzel.h
+ *
+ * Energy at a handful of fixed frequencies over a block of samples, cheaper than
+ * a full FFT when only a few bins are of interest.
+ */
+
+#pragma once
+
+#define GOERTZEL_MAX_BANDS 4
+
+class GoertzelBank {
+public:
+	/**
+	 * Bands with zero frequency are skipped
+	 */
+	void configure(float samplingFrequency, const float *frequencies, size_t count);
+
+	/**
+	 * @param bias raw value subtracted from every sample so that DC does not leak into the bands
+	 * @param inputScale converts raw samples to output units
+	 * @param meanSquares receives mean square amplitude per configured band, same units as RMS^2 of a sine at that frequency
+	 */
+	void process(const uint16_t *input, size_t count, float bias, float inputScale, float *meanSquares) const;
+
+	size_t getBandCount() const {
+		return m_count;
+	}
+
+private:
+	float m_coefficients[GOERTZEL_MAX_BANDS];
+	size_t m_count = 0;
+};
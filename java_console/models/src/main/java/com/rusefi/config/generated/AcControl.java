@@ -169,18 +169,18 @@ public class AcControl {
 	public static final int TCU_GEAR_COUNT = 10;
 	public static final int TPS_2_BYTE_PACKING_MULT = 100;
 	public static final int VE_BLEND_COUNT = 4;
-	public static final Field ACBUTTONSTATE = Field.create("ACBUTTONSTATE", 0, FieldType.INT8).setScale(1.0).setBaseOffset(1020);
-	public static final Field ALIGNMENTFILL_AT_1 = Field.create("ALIGNMENTFILL_AT_1", 1, FieldType.INT8).setScale(1.0).setBaseOffset(1020);
-	public static final Field M_ACENABLED = Field.create("M_ACENABLED", 4, FieldType.BIT, 0).setBaseOffset(1020);
-	public static final Field ENGINETOOSLOW = Field.create("ENGINETOOSLOW", 4, FieldType.BIT, 1).setBaseOffset(1020);
-	public static final Field ENGINETOOFAST = Field.create("ENGINETOOFAST", 4, FieldType.BIT, 2).setBaseOffset(1020);
-	public static final Field NOCLT = Field.create("NOCLT", 4, FieldType.BIT, 3).setBaseOffset(1020);
-	public static final Field ENGINETOOHOT = Field.create("ENGINETOOHOT", 4, FieldType.BIT, 4).setBaseOffset(1020);
-	public static final Field TPSTOOHIGH = Field.create("TPSTOOHIGH", 4, FieldType.BIT, 5).setBaseOffset(1020);
-	public static final Field ISDISABLEDBYLUA = Field.create("ISDISABLEDBYLUA", 4, FieldType.BIT, 6).setBaseOffset(1020);
-	public static final Field ACCOMPRESSORSTATE = Field.create("ACCOMPRESSORSTATE", 4, FieldType.BIT, 7).setBaseOffset(1020);
-	public static final Field LATEST_USAGE_AC_CONTROL = Field.create("LATEST_USAGE_AC_CONTROL", 8, FieldType.INT).setScale(1.0).setBaseOffset(1020);
-	public static final Field ACSWITCHLASTCHANGETIMEMS = Field.create("ACSWITCHLASTCHANGETIMEMS", 12, FieldType.INT).setScale(1.0).setBaseOffset(1020);
+	public static final Field ACBUTTONSTATE = Field.create("ACBUTTONSTATE", 0, FieldType.INT8).setScale(1.0).setBaseOffset(1028);
+	public static final Field ALIGNMENTFILL_AT_1 = Field.create("ALIGNMENTFILL_AT_1", 1, FieldType.INT8).setScale(1.0).setBaseOffset(1028);
+	public static final Field M_ACENABLED = Field.create("M_ACENABLED", 4, FieldType.BIT, 0).setBaseOffset(1028);
+	public static final Field ENGINETOOSLOW = Field.create("ENGINETOOSLOW", 4, FieldType.BIT, 1).setBaseOffset(1028);
+	public static final Field ENGINETOOFAST = Field.create("ENGINETOOFAST", 4, FieldType.BIT, 2).setBaseOffset(1028);
+	public static final Field NOCLT = Field.create("NOCLT", 4, FieldType.BIT, 3).setBaseOffset(1028);
+	public static final Field ENGINETOOHOT = Field.create("ENGINETOOHOT", 4, FieldType.BIT, 4).setBaseOffset(1028);
+	public static final Field TPSTOOHIGH = Field.create("TPSTOOHIGH", 4, FieldType.BIT, 5).setBaseOffset(1028);
+	public static final Field ISDISABLEDBYLUA = Field.create("ISDISABLEDBYLUA", 4, FieldType.BIT, 6).setBaseOffset(1028);
+	public static final Field ACCOMPRESSORSTATE = Field.create("ACCOMPRESSORSTATE", 4, FieldType.BIT, 7).setBaseOffset(1028);
+	public static final Field LATEST_USAGE_AC_CONTROL = Field.create("LATEST_USAGE_AC_CONTROL", 8, FieldType.INT).setScale(1.0).setBaseOffset(1028);
+	public static final Field ACSWITCHLASTCHANGETIMEMS = Field.create("ACSWITCHLASTCHANGETIMEMS", 12, FieldType.INT).setScale(1.0).setBaseOffset(1028);
 	public static final Field[] VALUES = {
 	ACBUTTONSTATE,
 	ALIGNMENTFILL_AT_1,
@@ -922,6 +922,7 @@ public class Fields {
 	public static final int InjectorNonlinearMode_INJ_FordModel = 2;
 	public static final int InjectorNonlinearMode_INJ_None = 0;
 	public static final int InjectorNonlinearMode_INJ_PolynomialAdder = 1;
+	public static final int KNOCK_SPECTRUM_BANDS = 4;
 	public static final int launchActivationMode_e_ALWAYS_ACTIVE_LAUNCH = 2;
 	public static final int launchActivationMode_e_CLUTCH_INPUT_LAUNCH = 1;
 	public static final int launchActivationMode_e_SWITCH_INPUT_LAUNCH = 0;
@@ -1086,6 +1087,8 @@ public class Fields {
 	public static final int TOOTH_DATA_LENGTH = 2000;
 	public static final int TOOTH_PACKET_COUNT = 1000;
 	public static final int TOOTH_PACKET_SIZE = 2;
+	public static final int ToothLogFormat_Compact = 1;
+	public static final int ToothLogFormat_Raw = 0;
 	public static final String TOP_DEAD_CENTER_MESSAGE = "r";
 	public static final int TORQUE_CURVE_SIZE = 6;
 	public static final int TOTAL_CONFIG_SIZE = 23880;
@@ -1246,6 +1249,7 @@ public class Fields {
 	public static final int TS_COMPOSITE_DISABLE = 2;
 	public static final int TS_COMPOSITE_ENABLE = 1;
 	public static final int TS_COMPOSITE_READ = 3;
+	public static final int TS_COMPOSITE_READ_COMPACT = 7;
 	public static final char TS_CRC_CHECK_COMMAND = 'k';
 	public static final char TS_EXECUTE = 'E';
 	public static final int TS_FILE_VERSION = 20230721;
@@ -1264,6 +1268,10 @@ public class Fields {
 	public static final char TS_PAGE_COMMAND = 'P';
 	public static final char TS_PERF_TRACE_BEGIN = '_';
 	public static final char TS_PERF_TRACE_GET_BUFFER = 'b';
+	public static final char TS_PERF_TRACE_STREAM = 'j';
+	public static final int TS_PERF_TRACE_STREAM_READ = 3;
+	public static final int TS_PERF_TRACE_STREAM_START = 1;
+	public static final int TS_PERF_TRACE_STREAM_STOP = 2;
 	public static final String TS_PROTOCOL = "001";
 	public static final char TS_QUERY_COMMAND = 'Q';
 	public static final char TS_READ_COMMAND = 'R';
@@ -1276,11 +1284,11 @@ public class Fields {
 	public static final int TS_RESPONSE_UNDERRUN = 0x80;
 	public static final int TS_RESPONSE_UNRECOGNIZED_COMMAND = 0x83;
 	public static final char TS_SET_LOGGER_SWITCH = 'l';
-	public static final String TS_SIGNATURE = "rusEFI master.2023.10.31.f407-discovery.3219724185";
+	public static final String TS_SIGNATURE = "rusEFI master.2023.10.31.f407-discovery.123208203";
 	public static final char TS_SIMULATE_CAN = '>';
 	public static final char TS_SINGLE_WRITE_COMMAND = 'W';
 	public static final char TS_TEST_COMMAND = 't';
-	public static final int TS_TOTAL_OUTPUT_SIZE = 1440;
+	public static final int TS_TOTAL_OUTPUT_SIZE = 1448;
 	public static final String TS_TRIGGER_SCOPE_CHANNEL_1_NAME = "Channel 1";
 	public static final String TS_TRIGGER_SCOPE_CHANNEL_2_NAME = "Channel 2";
 	public static final int TS_TRIGGER_SCOPE_DISABLE = 5;
@@ -2647,7 +2655,15 @@ public class Fields {
 	public static final Field SIMULATORCAMPOSITION2 = Field.create("SIMULATORCAMPOSITION2", 4311, FieldType.INT8).setScale(1.0).setBaseOffset(0);
 	public static final Field SIMULATORCAMPOSITION3 = Field.create("SIMULATORCAMPOSITION3", 4312, FieldType.INT8).setScale(1.0).setBaseOffset(0);
 	public static final Field SIMULATORCAMPOSITION4 = Field.create("SIMULATORCAMPOSITION4", 4313, FieldType.INT8).setScale(1.0).setBaseOffset(0);
-	public static final Field MAINUNUSEDEND = Field.create("MAINUNUSEDEND", 4314, FieldType.INT8).setScale(1.0).setBaseOffset(0);
+	public static final Field KNOCKSPECTRUMBANDS1 = Field.create("KNOCKSPECTRUMBANDS1", 4314, FieldType.INT8).setScale(0.1).setBaseOffset(0);
+	public static final Field KNOCKSPECTRUMBANDS2 = Field.create("KNOCKSPECTRUMBANDS2", 4315, FieldType.INT8).setScale(0.1).setBaseOffset(0);
+	public static final Field KNOCKSPECTRUMBANDS3 = Field.create("KNOCKSPECTRUMBANDS3", 4316, FieldType.INT8).setScale(0.1).setBaseOffset(0);
+	public static final Field KNOCKSPECTRUMBANDS4 = Field.create("KNOCKSPECTRUMBANDS4", 4317, FieldType.INT8).setScale(0.1).setBaseOffset(0);
+	public static final Field LUAHOOKBUDGET = Field.create("LUAHOOKBUDGET", 4318, FieldType.INT16).setScale(1.0).setBaseOffset(0);
+	public static final Field SDCARDLOGSLOWDIVIDER = Field.create("SDCARDLOGSLOWDIVIDER", 4320, FieldType.INT8).setScale(1.0).setBaseOffset(0);
+	public static final String[] ToothLogFormat = {"Raw", "Compact"};
+	public static final Field SDTRIGGERLOGFORMAT = Field.create("SDTRIGGERLOGFORMAT", 4321, FieldType.INT8, ToothLogFormat).setScale(1.0).setBaseOffset(0);
+	public static final Field MAINUNUSEDEND = Field.create("MAINUNUSEDEND", 4322, FieldType.INT8).setScale(1.0).setBaseOffset(0);
 	public static final Field ETBBIASBINS = Field.create("ETBBIASBINS", 4556, FieldType.FLOAT).setBaseOffset(0);
 	public static final Field ETBBIASVALUES = Field.create("ETBBIASVALUES", 4588, FieldType.FLOAT).setBaseOffset(0);
 	public static final Field IACPIDMULTTABLE = Field.create("IACPIDMULTTABLE", 4620, FieldType.INT8).setScale(0.05).setBaseOffset(0);
@@ -4207,6 +4223,13 @@ public class Fields {
 	SIMULATORCAMPOSITION2,
 	SIMULATORCAMPOSITION3,
 	SIMULATORCAMPOSITION4,
+	KNOCKSPECTRUMBANDS1,
+	KNOCKSPECTRUMBANDS2,
+	KNOCKSPECTRUMBANDS3,
+	KNOCKSPECTRUMBANDS4,
+	LUAHOOKBUDGET,
+	SDCARDLOGSLOWDIVIDER,
+	SDTRIGGERLOGFORMAT,
 	MAINUNUSEDEND,
 	ETBBIASBINS,
 	ETBBIASVALUES,
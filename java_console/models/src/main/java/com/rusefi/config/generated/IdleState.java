@@ -169,34 +169,34 @@ public class IdleState {
 	public static final int TCU_GEAR_COUNT = 10;
 	public static final int TPS_2_BYTE_PACKING_MULT = 100;
 	public static final int VE_BLEND_COUNT = 4;
-	public static final Field IDLESTATE = Field.create("IDLESTATE", 0, FieldType.INT).setScale(1.0).setBaseOffset(1296);
-	public static final Field CURRENTIDLEPOSITION = Field.create("CURRENTIDLEPOSITION", 4, FieldType.FLOAT).setBaseOffset(1296);
-	public static final Field BASEIDLEPOSITION = Field.create("BASEIDLEPOSITION", 8, FieldType.FLOAT).setBaseOffset(1296);
-	public static final Field IDLECLOSEDLOOP = Field.create("IDLECLOSEDLOOP", 12, FieldType.FLOAT).setBaseOffset(1296);
-	public static final Field IACBYTPSTAPER = Field.create("IACBYTPSTAPER", 16, FieldType.FLOAT).setBaseOffset(1296);
-	public static final Field THROTTLEPEDALUPSTATE = Field.create("THROTTLEPEDALUPSTATE", 20, FieldType.INT).setScale(1.0).setBaseOffset(1296);
-	public static final Field MIGHTRESETPID = Field.create("MIGHTRESETPID", 24, FieldType.BIT, 0).setBaseOffset(1296);
-	public static final Field SHOULDRESETPID = Field.create("SHOULDRESETPID", 24, FieldType.BIT, 1).setBaseOffset(1296);
-	public static final Field WASRESETPID = Field.create("WASRESETPID", 24, FieldType.BIT, 2).setBaseOffset(1296);
-	public static final Field MUSTRESETPID = Field.create("MUSTRESETPID", 24, FieldType.BIT, 3).setBaseOffset(1296);
-	public static final Field ISCRANKING = Field.create("ISCRANKING", 24, FieldType.BIT, 4).setBaseOffset(1296);
-	public static final Field ISIACTABLEFORCOASTING = Field.create("ISIACTABLEFORCOASTING", 24, FieldType.BIT, 5).setBaseOffset(1296);
-	public static final Field NOTIDLING = Field.create("NOTIDLING", 24, FieldType.BIT, 6).setBaseOffset(1296);
-	public static final Field NEEDRESET = Field.create("NEEDRESET", 24, FieldType.BIT, 7).setBaseOffset(1296);
-	public static final Field ISINDEADZONE = Field.create("ISINDEADZONE", 24, FieldType.BIT, 8).setBaseOffset(1296);
-	public static final Field ISBLIPPING = Field.create("ISBLIPPING", 24, FieldType.BIT, 9).setBaseOffset(1296);
-	public static final Field USECLOSEDLOOP = Field.create("USECLOSEDLOOP", 24, FieldType.BIT, 10).setBaseOffset(1296);
-	public static final Field BADTPS = Field.create("BADTPS", 24, FieldType.BIT, 11).setBaseOffset(1296);
-	public static final Field LOOKSLIKERUNNING = Field.create("LOOKSLIKERUNNING", 24, FieldType.BIT, 12).setBaseOffset(1296);
-	public static final Field LOOKSLIKECOASTING = Field.create("LOOKSLIKECOASTING", 24, FieldType.BIT, 13).setBaseOffset(1296);
-	public static final Field LOOKSLIKECRANKTOIDLE = Field.create("LOOKSLIKECRANKTOIDLE", 24, FieldType.BIT, 14).setBaseOffset(1296);
-	public static final Field ISIDLECOASTING = Field.create("ISIDLECOASTING", 24, FieldType.BIT, 15).setBaseOffset(1296);
-	public static final Field ISIDLECLOSEDLOOP = Field.create("ISIDLECLOSEDLOOP", 24, FieldType.BIT, 16).setBaseOffset(1296);
-	public static final Field IDLETARGET = Field.create("IDLETARGET", 28, FieldType.INT).setScale(1.0).setBaseOffset(1296);
-	public static final Field TARGETRPMBYCLT = Field.create("TARGETRPMBYCLT", 32, FieldType.INT).setScale(1.0).setBaseOffset(1296);
-	public static final Field TARGETRPMAC = Field.create("TARGETRPMAC", 36, FieldType.INT).setScale(1.0).setBaseOffset(1296);
-	public static final Field IACBYRPMTAPER = Field.create("IACBYRPMTAPER", 40, FieldType.FLOAT).setBaseOffset(1296);
-	public static final Field LUAADD = Field.create("LUAADD", 44, FieldType.FLOAT).setBaseOffset(1296);
+	public static final Field IDLESTATE = Field.create("IDLESTATE", 0, FieldType.INT).setScale(1.0).setBaseOffset(1304);
+	public static final Field CURRENTIDLEPOSITION = Field.create("CURRENTIDLEPOSITION", 4, FieldType.FLOAT).setBaseOffset(1304);
+	public static final Field BASEIDLEPOSITION = Field.create("BASEIDLEPOSITION", 8, FieldType.FLOAT).setBaseOffset(1304);
+	public static final Field IDLECLOSEDLOOP = Field.create("IDLECLOSEDLOOP", 12, FieldType.FLOAT).setBaseOffset(1304);
+	public static final Field IACBYTPSTAPER = Field.create("IACBYTPSTAPER", 16, FieldType.FLOAT).setBaseOffset(1304);
+	public static final Field THROTTLEPEDALUPSTATE = Field.create("THROTTLEPEDALUPSTATE", 20, FieldType.INT).setScale(1.0).setBaseOffset(1304);
+	public static final Field MIGHTRESETPID = Field.create("MIGHTRESETPID", 24, FieldType.BIT, 0).setBaseOffset(1304);
+	public static final Field SHOULDRESETPID = Field.create("SHOULDRESETPID", 24, FieldType.BIT, 1).setBaseOffset(1304);
+	public static final Field WASRESETPID = Field.create("WASRESETPID", 24, FieldType.BIT, 2).setBaseOffset(1304);
+	public static final Field MUSTRESETPID = Field.create("MUSTRESETPID", 24, FieldType.BIT, 3).setBaseOffset(1304);
+	public static final Field ISCRANKING = Field.create("ISCRANKING", 24, FieldType.BIT, 4).setBaseOffset(1304);
+	public static final Field ISIACTABLEFORCOASTING = Field.create("ISIACTABLEFORCOASTING", 24, FieldType.BIT, 5).setBaseOffset(1304);
+	public static final Field NOTIDLING = Field.create("NOTIDLING", 24, FieldType.BIT, 6).setBaseOffset(1304);
+	public static final Field NEEDRESET = Field.create("NEEDRESET", 24, FieldType.BIT, 7).setBaseOffset(1304);
+	public static final Field ISINDEADZONE = Field.create("ISINDEADZONE", 24, FieldType.BIT, 8).setBaseOffset(1304);
+	public static final Field ISBLIPPING = Field.create("ISBLIPPING", 24, FieldType.BIT, 9).setBaseOffset(1304);
+	public static final Field USECLOSEDLOOP = Field.create("USECLOSEDLOOP", 24, FieldType.BIT, 10).setBaseOffset(1304);
+	public static final Field BADTPS = Field.create("BADTPS", 24, FieldType.BIT, 11).setBaseOffset(1304);
+	public static final Field LOOKSLIKERUNNING = Field.create("LOOKSLIKERUNNING", 24, FieldType.BIT, 12).setBaseOffset(1304);
+	public static final Field LOOKSLIKECOASTING = Field.create("LOOKSLIKECOASTING", 24, FieldType.BIT, 13).setBaseOffset(1304);
+	public static final Field LOOKSLIKECRANKTOIDLE = Field.create("LOOKSLIKECRANKTOIDLE", 24, FieldType.BIT, 14).setBaseOffset(1304);
+	public static final Field ISIDLECOASTING = Field.create("ISIDLECOASTING", 24, FieldType.BIT, 15).setBaseOffset(1304);
+	public static final Field ISIDLECLOSEDLOOP = Field.create("ISIDLECLOSEDLOOP", 24, FieldType.BIT, 16).setBaseOffset(1304);
+	public static final Field IDLETARGET = Field.create("IDLETARGET", 28, FieldType.INT).setScale(1.0).setBaseOffset(1304);
+	public static final Field TARGETRPMBYCLT = Field.create("TARGETRPMBYCLT", 32, FieldType.INT).setScale(1.0).setBaseOffset(1304);
+	public static final Field TARGETRPMAC = Field.create("TARGETRPMAC", 36, FieldType.INT).setScale(1.0).setBaseOffset(1304);
+	public static final Field IACBYRPMTAPER = Field.create("IACBYRPMTAPER", 40, FieldType.FLOAT).setBaseOffset(1304);
+	public static final Field LUAADD = Field.create("LUAADD", 44, FieldType.FLOAT).setBaseOffset(1304);
 	public static final Field[] VALUES = {
 	IDLESTATE,
 	CURRENTIDLEPOSITION,
@@ -186,6 +186,11 @@ public class KnockController {
 	public static final Field M_KNOCKTHRESHOLD = Field.create("M_KNOCKTHRESHOLD", 20, FieldType.FLOAT).setBaseOffset(892);
 	public static final Field M_KNOCKCOUNT = Field.create("M_KNOCKCOUNT", 24, FieldType.INT).setScale(1.0).setBaseOffset(892);
 	public static final Field M_MAXIMUMRETARD = Field.create("M_MAXIMUMRETARD", 28, FieldType.FLOAT).setBaseOffset(892);
+	public static final Field M_KNOCKDROPPEDWINDOWS = Field.create("M_KNOCKDROPPEDWINDOWS", 32, FieldType.INT).setScale(1.0).setBaseOffset(892);
+	public static final Field M_KNOCKBAND1 = Field.create("M_KNOCKBAND1", 36, FieldType.INT8).setScale(1.0).setBaseOffset(892);
+	public static final Field M_KNOCKBAND2 = Field.create("M_KNOCKBAND2", 37, FieldType.INT8).setScale(1.0).setBaseOffset(892);
+	public static final Field M_KNOCKBAND3 = Field.create("M_KNOCKBAND3", 38, FieldType.INT8).setScale(1.0).setBaseOffset(892);
+	public static final Field M_KNOCKBAND4 = Field.create("M_KNOCKBAND4", 39, FieldType.INT8).setScale(1.0).setBaseOffset(892);
 	public static final Field[] VALUES = {
 	M_KNOCKLEVEL,
 	M_KNOCKCYL1,
@@ -204,5 +209,10 @@ public class KnockController {
 	M_KNOCKTHRESHOLD,
 	M_KNOCKCOUNT,
 	M_MAXIMUMRETARD,
+	M_KNOCKDROPPEDWINDOWS,
+	M_KNOCKBAND1,
+	M_KNOCKBAND2,
+	M_KNOCKBAND3,
+	M_KNOCKBAND4,
 	};
 }
@@ -6,8 +6,8 @@ package com.rusefi.config.generated;
 import com.rusefi.config.*;
 
 public class WallFuelState {
-	public static final Field WALLFUELCORRECTION = Field.create("WALLFUELCORRECTION", 0, FieldType.FLOAT).setBaseOffset(1288);
-	public static final Field WALLFUEL = Field.create("WALLFUEL", 4, FieldType.FLOAT).setBaseOffset(1288);
+	public static final Field WALLFUELCORRECTION = Field.create("WALLFUELCORRECTION", 0, FieldType.FLOAT).setBaseOffset(1296);
+	public static final Field WALLFUEL = Field.create("WALLFUEL", 4, FieldType.FLOAT).setBaseOffset(1296);
 	public static final Field[] VALUES = {
 	WALLFUELCORRECTION,
 	WALLFUEL,
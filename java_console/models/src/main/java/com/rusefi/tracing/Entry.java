@@ -109,6 +109,65 @@ public class Entry {
         return result;
     }
 
+    /**
+     * Continuous trace: every chunk is TS result code, 8 byte header (sequence, entry count, dropped events)
+     * and entries. Timestamps are unwrapped across chunks so that captures longer than one period of the
+     * 32 bit counter still come out in order.
+     */
+    public static List<Entry> parseStream(List<byte[]> chunks) {
+        List<Entry> result = new ArrayList<>();
+        long previousTimestamp = -1;
+        long wrapOffset = 0;
+        long firstTimestamp = -1;
+        int droppedEvents = 0;
+        try {
+            for (byte[] packet : chunks) {
+                DataInputStream is = new DataInputStream(new ByteArrayInputStream(packet));
+                is.readByte(); // skip TS result code
+                int sequence = readShort(is);
+                int count = readShort(is);
+                int dropped = readInt(is);
+                if (dropped != droppedEvents) {
+                    System.out.println("Chunk " + sequence + ": " + (dropped - droppedEvents) + " events dropped before it");
+                    droppedEvents = dropped;
+                }
+
+                for (int i = 0; i < count; i++) {
+                    byte type = is.readByte();
+                    byte phase = is.readByte();
+                    byte isr = is.readByte();
+                    byte thread = is.readByte();
+                    long timestampNt = readInt(is) & 0xFFFFFFFFL;
+
+                    if (previousTimestamp >= 0 && timestampNt + wrapOffset < previousTimestamp - (1L << 31))
+                        wrapOffset += 1L << 32;
+                    timestampNt += wrapOffset;
+                    previousTimestamp = timestampNt;
+                    if (firstTimestamp < 0)
+                        firstTimestamp = timestampNt;
+
+                    String name = type == 1 ? "ISR: " + thread : TypeNames[type];
+                    result.add(new Entry(name, Phase.decode(phase), (timestampNt - firstTimestamp) / MAGIC_NT, isr, thread));
+                }
+            }
+        } catch (IOException e) {
+            throw new IllegalStateException(e);
+        }
+        return result;
+    }
+
+    private static int readShort(DataInputStream in) throws IOException {
+        int ch1 = in.read();
+        int ch2 = in.read();
+        if ((ch1 | ch2) < 0)
+            throw new EOFException();
+        return (ch2 << 8) + ch1;
+    }
+
+    public double getTimestampSeconds() {
+        return timestampSeconds;
+    }
+
     private void adjustTimestamp(double minValue) {
         timestampSeconds -= minValue;
     }
@@ -4,6 +4,9 @@ import com.rusefi.tracing.Entry;
 import com.rusefi.tracing.Phase;
 import org.junit.Test;
 
+import java.util.Arrays;
+import java.util.List;
+
 import static org.junit.Assert.assertEquals;
 
 public class EntryTest {
@@ -14,4 +17,26 @@ public class EntryTest {
         assertEquals("{\"name\":\"hello\",\"ph\":\"E\",\"tid\":0,\"pid\":0,\"ts\":0.1}", e.toString());
 
     }
+
+    @Test
+    public void testParseStreamUnwrapsTimestamps() {
+        byte[] first = {
+                0, // TS result code
+                0, 0, 2, 0, 0, 0, 0, 0, // sequence 0, 2 entries, nothing dropped
+                4, 0, 0, 1, (byte) 0xF0, (byte) 0xFF, (byte) 0xFF, (byte) 0xFF,
+                4, 1, 0, 1, (byte) 0xF8, (byte) 0xFF, (byte) 0xFF, (byte) 0xFF,
+        };
+        byte[] second = {
+                0,
+                1, 0, 1, 0, 5, 0, 0, 0, // sequence 1, 1 entry, 5 dropped
+                // counter wrapped
+                4, 0, 0, 1, 8, 0, 0, 0,
+        };
+
+        List<Entry> entries = Entry.parseStream(Arrays.asList(first, second));
+        assertEquals(3, entries.size());
+        assertEquals(0, entries.get(0).getTimestampSeconds(), 1e-9);
+        assertEquals(8 / 168.0, entries.get(1).getTimestampSeconds(), 1e-9);
+        assertEquals(24 / 168.0, entries.get(2).getTimestampSeconds(), 1e-9);
+    }
 }
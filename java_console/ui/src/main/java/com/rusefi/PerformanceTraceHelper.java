@@ -9,6 +9,7 @@ import com.rusefi.ui.RpmModel;
 import javax.swing.*;
 import java.io.FileOutputStream;
 import java.io.IOException;
+import java.util.ArrayList;
 import java.util.List;
 
 import static com.rusefi.binaryprotocol.IoHelper.checkResponseCode;
@@ -41,6 +42,46 @@ public class PerformanceTraceHelper {
         }
     }
 
+    /**
+     * Continuous capture: keep draining trace chunks for the given time
+     */
+    public static void grabStreamingPerformanceTrace(BinaryProtocol bp, int durationMs) {
+        bp.executeCommand(Fields.TS_PERF_TRACE_STREAM, new byte[]{Fields.TS_PERF_TRACE_STREAM_START}, "start trace stream");
+
+        List<byte[]> chunks = new ArrayList<>();
+        long end = System.currentTimeMillis() + durationMs;
+        boolean stopped = false;
+        try {
+            while (true) {
+                if (!stopped && System.currentTimeMillis() > end) {
+                    bp.executeCommand(Fields.TS_PERF_TRACE_STREAM, new byte[]{Fields.TS_PERF_TRACE_STREAM_STOP}, "stop trace stream");
+                    stopped = true;
+                }
+
+                byte[] packet = bp.executeCommand(Fields.TS_PERF_TRACE_STREAM, new byte[]{Fields.TS_PERF_TRACE_STREAM_READ}, "read trace stream");
+                if (!checkResponseCode(packet, (byte) Fields.TS_RESPONSE_OK))
+                    throw new IllegalStateException("Unexpected packet");
+                if (packet.length > 1) {
+                    chunks.add(packet);
+                } else if (stopped) {
+                    // everything was drained
+                    break;
+                } else {
+                    Thread.sleep(1);
+                }
+            }
+
+            List<Entry> data = Entry.parseStream(chunks);
+
+            int rpm = RpmModel.getInstance().getValue();
+            String fileName = FileLog.getDate() + "_rpm_" + rpm + "_rusEFI_trace_stream" + ".json";
+
+            JsonOutput.writeToStream(data, new FileOutputStream(fileName));
+        } catch (IOException | InterruptedException e1) {
+            throw new IllegalStateException(e1);
+        }
+    }
+
     public static void getPerformanceTune() {
         startAndConnect(linkManager -> {
             BinaryProtocol binaryProtocol = linkManager.getConnector().getBinaryProtocol();
@@ -49,4 +90,14 @@ public class PerformanceTraceHelper {
             return null;
         });
     }
+
+    public static void getStreamingPerformanceTrace(String[] args) {
+        int durationMs = args.length > 1 ? Integer.parseInt(args[1]) : 5000;
+        startAndConnect(linkManager -> {
+            BinaryProtocol binaryProtocol = linkManager.getConnector().getBinaryProtocol();
+            grabStreamingPerformanceTrace(binaryProtocol, durationMs);
+            System.exit(0);
+            return null;
+        });
+    }
 }
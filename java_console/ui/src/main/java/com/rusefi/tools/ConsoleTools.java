@@ -93,6 +93,7 @@ public class ConsoleTools {
         registerTool("read_tune", args -> readTune(), "Read tune from controller");
         registerTool("write_tune", ConsoleTools::writeTune, "Write specified XML tune into controller");
         registerTool("get_performance_trace", args -> PerformanceTraceHelper.getPerformanceTune(), "DEV TOOL: Get performance trace from ECU");
+        registerTool("get_performance_trace_stream", PerformanceTraceHelper::getStreamingPerformanceTrace, "DEV TOOL: Get continuous performance trace from ECU, optional duration in ms");
 
         registerTool("version", ConsoleTools::version, "Only print version");
 
@@ -23,8 +23,14 @@ public class GetConfigValueConsumerTest {
         state.readBufferedReader(test, getConfigValueConsumer);
 
         assertEquals(
-                "float getConfigValueByName(const char *name) {\n" +
+                "float getConfigValueByHash(const int hash, bool *isFound) {\n" +
+                        "\tif (isFound) {\n" +
+                        "\t\t*isFound = false;\n" +
+                        "\t}\n" +
                         "\treturn EFI_ERROR_CODE;\n" +
+                        "}\n" +
+                        "float getConfigValueByName(const char *name) {\n" +
+                        "\treturn getConfigValueByHash(djb2lowerCase(name));\n" +
                         "}\n", getConfigValueConsumer.getCompleteGetterBody());
     }
 
@@ -64,8 +70,7 @@ public class GetConfigValueConsumerTest {
         assertEquals("// generated by GetConfigValueConsumer.java\n" +
                 "#include \"pch.h\"\n" +
                 "#include \"value_lookup.h\"\n" +
-                "float getConfigValueByName(const char *name) {\n" +
-                "\tint hash = djb2lowerCase(name);\n" +
+                "float getConfigValueByHash(const int hash, bool *isFound) {\n" +
                 "\tswitch(hash) {\n" +
                 "// iat.config.tempC_1\n" +
                 "\t\tcase -672272162:\n" +
@@ -74,8 +79,14 @@ public class GetConfigValueConsumerTest {
                 "\t\tcase -1237776078:\n" +
                 "\t\t\treturn config->iat.adcChannel;\n" +
                 "\t}\n" +
+                "\tif (isFound) {\n" +
+                "\t\t*isFound = false;\n" +
+                "\t}\n" +
                 "\treturn EFI_ERROR_CODE;\n" +
                 "}\n" +
+                "float getConfigValueByName(const char *name) {\n" +
+                "\treturn getConfigValueByHash(djb2lowerCase(name));\n" +
+                "}\n" +
                 "bool setConfigValueByName(const char *name, float value) {\n" +
                 "\tint hash = djb2lowerCase(name);\n" +
                 "\tswitch(hash) {\n" +
@@ -94,8 +105,7 @@ public class GetConfigValueConsumerTest {
                 "}\n", getConfigValueConsumer.getContent());
 
 
-        assertEquals("float getConfigValueByName(const char *name) {\n" +
-                "\tint hash = djb2lowerCase(name);\n" +
+        assertEquals("float getConfigValueByHash(const int hash, bool *isFound) {\n" +
                 "\tswitch(hash) {\n" +
                 "// iat.config.tempC_1\n" +
                 "\t\tcase -672272162:\n" +
@@ -104,7 +114,13 @@ public class GetConfigValueConsumerTest {
                 "\t\tcase -1237776078:\n" +
                 "\t\t\treturn config->iat.adcChannel;\n" +
                 "\t}\n" +
+                "\tif (isFound) {\n" +
+                "\t\t*isFound = false;\n" +
+                "\t}\n" +
                 "\treturn EFI_ERROR_CODE;\n" +
+                "}\n" +
+                "float getConfigValueByName(const char *name) {\n" +
+                "\treturn getConfigValueByHash(djb2lowerCase(name));\n" +
                 "}\n", getConfigValueConsumer.getCompleteGetterBody());
     }
 
@@ -166,8 +182,7 @@ public class GetConfigValueConsumerTest {
         assertEquals("// generated by GetConfigValueConsumer.java\n" +
                 "#include \"pch.h\"\n" +
                 "#include \"value_lookup.h\"\n" +
-                "float getConfigValueByName(const char *name) {\n" +
-                "\tint hash = djb2lowerCase(name);\n" +
+                "float getConfigValueByHash(const int hash, bool *isFound) {\n" +
                 "\tswitch(hash) {\n" +
                 "// clt.config.tempC_1\n" +
                 "\t\tcase -1832527325:\n" +
@@ -212,7 +227,13 @@ public class GetConfigValueConsumerTest {
                 "\t\tcase -298185774:\n" +
                 "\t\t\treturn config->enableFan1WithAc;\n" +
                 "\t}\n" +
+                "\tif (isFound) {\n" +
+                "\t\t*isFound = false;\n" +
+                "\t}\n" +
                 "\treturn EFI_ERROR_CODE;\n" +
+                "}\n" +
+                "float getConfigValueByName(const char *name) {\n" +
+                "\treturn getConfigValueByHash(djb2lowerCase(name));\n" +
                 "}\n", getConfigValueConsumer.getHeaderAndGetter());
 
 
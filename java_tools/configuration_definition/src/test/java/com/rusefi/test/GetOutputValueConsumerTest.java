@@ -26,8 +26,7 @@ public class GetOutputValueConsumerTest {
                         "// generated by GetOutputValueConsumer.java\n" +
                         "#include \"pch.h\"\n" +
                         "#include \"value_lookup.h\"\n" +
-                        "float getOutputValueByName(const char *name) {\n" +
-                        "\tint hash = djb2lowerCase(name);\n" +
+                        "float getOutputValueByHash(const int hash, bool *isFound) {\n" +
                         "\tswitch(hash) {\n" +
                         "// issue_294_31\n" +
                         "#if EFI_BOOST_CONTROL\n" +
@@ -45,8 +44,14 @@ public class GetOutputValueConsumerTest {
                         "\t\t\treturn engine->outputChannels->hwChannel;\n" +
                         "#endif\n" +
                         "\t}\n" +
+                        "\tif (isFound) {\n" +
+                        "\t\t*isFound = false;\n" +
+                        "\t}\n" +
                         "\treturn EFI_ERROR_CODE;\n" +
                         "}\n" +
+                        "float getOutputValueByName(const char *name) {\n" +
+                        "\treturn getOutputValueByHash(djb2lowerCase(name));\n" +
+                        "}\n" +
                         "#endif\n", outputValueConsumer.getContent());
     }
 
@@ -71,8 +76,7 @@ public class GetOutputValueConsumerTest {
                         "// generated by GetOutputValueConsumer.java\n" +
                         "#include \"pch.h\"\n" +
                         "#include \"value_lookup.h\"\n" +
-                        "float getOutputValueByName(const char *name) {\n" +
-                        "\tint hash = djb2lowerCase(name);\n" +
+                        "float getOutputValueByHash(const int hash, bool *isFound) {\n" +
                         "\tswitch(hash) {\n" +
                         "// isPrime\n" +
                         "\t\tcase -1429286498:\n" +
@@ -87,8 +91,14 @@ public class GetOutputValueConsumerTest {
                         "\t\tcase -381519965:\n" +
                         "\t\t\treturn engine->module<FuelPumpController>()->ignitionOn;\n" +
                         "\t}\n" +
+                        "\tif (isFound) {\n" +
+                        "\t\t*isFound = false;\n" +
+                        "\t}\n" +
                         "\treturn EFI_ERROR_CODE;\n" +
                         "}\n" +
+                        "float getOutputValueByName(const char *name) {\n" +
+                        "\treturn getOutputValueByHash(djb2lowerCase(name));\n" +
+                        "}\n" +
                         "#endif\n", outputValueConsumer.getContent());
     }
 }
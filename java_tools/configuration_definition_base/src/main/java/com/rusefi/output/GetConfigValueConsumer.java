@@ -34,10 +34,10 @@ public class GetConfigValueConsumer implements ConfigurationConsumer {
                 "#include \"value_lookup.h\"\n";
     }
 
-    private static final String GET_METHOD_HEADER =
-            "float getConfigValueByName(const char *name) {\n";
-
     static final String GET_METHOD_FOOTER = "\treturn EFI_ERROR_CODE;\n" + "}\n";
+    static final String GET_BY_HASH_METHOD_FOOTER = "\tif (isFound) {\n" +
+            "\t\t*isFound = false;\n" +
+            "\t}\n" + GET_METHOD_FOOTER;
     private static final String SET_METHOD_HEADER = "bool setConfigValueByName(const char *name, float value) {\n";
     private static final String SET_METHOD_FOOTER = "}\n";
     private final List<VariableRecord> variables = new ArrayList<>();
@@ -145,11 +145,7 @@ public class GetConfigValueConsumer implements ConfigurationConsumer {
 
         StringBuilder getterBody = GetOutputValueConsumer.getGetters(switchBody, variables);
 
-        String fullSwitch = GetOutputValueConsumer.wrapSwitchStatement(switchBody);
-
-        return GET_METHOD_HEADER +
-                fullSwitch +
-                getterBody + GET_METHOD_FOOTER;
+        return GetOutputValueConsumer.getGetterMethods("getConfigValue", switchBody, getterBody);
     }
 
     public String getSetterBody() {
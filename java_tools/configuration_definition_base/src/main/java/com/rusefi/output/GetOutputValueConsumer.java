@@ -82,16 +82,30 @@ public class GetOutputValueConsumer implements ConfigurationConsumer {
 
         StringBuilder getterBody = getGetters(switchBody, getterPairs);
 
-        String fullSwitch = wrapSwitchStatement(switchBody);
-
         return  "#if !EFI_UNIT_TEST\n" +
                 GetConfigValueConsumer.getHeader(getClass()) +
-                "float getOutputValueByName(const char *name) {\n" +
-                fullSwitch +
-                getterBody + GetConfigValueConsumer.GET_METHOD_FOOTER +
+                getGetterMethods("getOutputValue", switchBody, getterBody) +
                 "#endif\n";
     }
 
+    /**
+     * By-hash getter lets Lua resolve a name once and skip string hashing on every call,
+     * by-name getter handles hash conflicts and delegates everything else.
+     * By-hash getter reports through 'isFound' names which it does not know, hash-conflicting ones included.
+     */
+    @NotNull
+    static String getGetterMethods(String methodPrefix, StringBuilder switchBody, StringBuilder getterBody) {
+        String hashSwitch = switchBody.length() == 0 ? "" :
+                ("\tswitch(hash) {\n" + switchBody + "\t}\n");
+        return "float " + methodPrefix + "ByHash(const int hash, bool *isFound) {\n" +
+                hashSwitch +
+                GetConfigValueConsumer.GET_BY_HASH_METHOD_FOOTER +
+                "float " + methodPrefix + "ByName(const char *name) {\n" +
+                getterBody +
+                "\treturn " + methodPrefix + "ByHash(djb2lowerCase(name));\n" +
+                "}\n";
+    }
+
     @NotNull
     static String wrapSwitchStatement(StringBuilder switchBody) {
         String fullSwitch = switchBody.length() == 0 ? "" :
@@ -137,6 +137,13 @@ bool verboseMode = true;
 
 static virtual_timer_t exitTimer;
 
+static const char* perfTraceFileName = nullptr;
+
+static void writePerfTrace() {
+	int eventCount = perfTraceHostWriteJson(perfTraceFileName);
+	printf("perf trace: %d events written to %s\n", eventCount, perfTraceFileName);
+}
+
 /*------------------------------------------------------------------------*
  * Simulator main.                                                        *
  *------------------------------------------------------------------------*/
@@ -153,6 +160,13 @@ int main(int argc, char** argv) {
 	halInit();
 	chSysInit();
 
+	// host profiling: RUSEFI_PERF_TRACE=trace.json build/rusefi_simulator 10
+	perfTraceFileName = getenv("RUSEFI_PERF_TRACE");
+	if (perfTraceFileName) {
+		perfTraceHostStart();
+		atexit(writePerfTrace);
+	}
+
 	if (argc == 2) {
 		int timeoutSeconds = atoi(argv[1]);
 		printf("Running rusEFI simulator for %d seconds, then exiting.\n\n", timeoutSeconds);
@@ -31,7 +31,8 @@
 
 #define EFI_ANTILAG_SYSTEM TRUE
 
-#define ENABLE_PERF_TRACE FALSE
+// host builds record with a wall clock, see perfTraceHostStart
+#define ENABLE_PERF_TRACE TRUE
 
 #define EFI_PRINTF_FUEL_DETAILS FALSE
 
@@ -153,6 +154,8 @@
 #define SPARK_EXTREME_LOGGING FALSE
 #define DEBUG_PWM FALSE
 #define EFI_SIGNAL_EXECUTOR_ONE_TIMER FALSE
+// simulated engine is where predictive scheduling gets exercised end to end
+#define EFI_PREDICTIVE_ANGLE_SCHEDULING TRUE
 #define EFI_TUNER_STUDIO_VERBOSE FALSE
 #define EFI_FILE_LOGGING TRUE
 #define EFI_WARNING_LED FALSE
@@ -167,4 +170,5 @@
 #define EFI_BOARD_TEST FALSE
 
 #define EFI_LUA TRUE
+#define EFI_LUA_BYTECODE_CACHE TRUE
 #define LUA_USER_HEAP 100000
@@ -27,7 +27,8 @@
 
 #define EFI_CJ125 TRUE
 
-#define ENABLE_PERF_TRACE FALSE
+// host builds record with a wall clock, see perfTraceHostStart
+#define ENABLE_PERF_TRACE TRUE
 
 #define EFI_TOOTH_LOGGER TRUE
 
@@ -59,6 +60,9 @@
 
 #define EFI_SIGNAL_EXECUTOR_ONE_TIMER FALSE
 #define EFI_SIGNAL_EXECUTOR_SLEEP FALSE
+#define EFI_EVENT_QUEUE_HEAP FALSE
+// exact event timestamps in many tests assume cached RPM, see test_angle_prediction.cpp for tests which turn it on
+#define EFI_PREDICTIVE_ANGLE_SCHEDULING FALSE
 
 #define EFI_SHAFT_POSITION_INPUT TRUE
 #define EFI_ENGINE_CONTROL TRUE
@@ -70,6 +74,7 @@
 #define EFI_MAP_AVERAGING TRUE
 
 #define EFI_LUA TRUE
+#define EFI_LUA_BYTECODE_CACHE TRUE
 
 #define EFI_HPFP TRUE
 
@@ -21,7 +21,19 @@ GTEST_API_ int main(int argc, char **argv) {
 	 */
 //	setVerboseTrigger(true);
 	//::testing::GTEST_FLAG(filter) = "*AllTriggersFixture*";
+
+	// host profiling: RUSEFI_PERF_TRACE=trace.json build/rusefi_test, then open in chrome://tracing or Perfetto
+	const char* perfTraceFileName = getenv("RUSEFI_PERF_TRACE");
+	if (perfTraceFileName) {
+		perfTraceHostStart();
+	}
+
 	int result = RUN_ALL_TESTS();
+
+	if (perfTraceFileName) {
+		int eventCount = perfTraceHostWriteJson(perfTraceFileName);
+		printf("perf trace: %d events written to %s\n", eventCount, perfTraceFileName);
+	}
 	// windows ERRORLEVEL in Jenkins batch file seems to want negative value to detect failure
 	return result == 0 ? 0 : -1;
 }
@@ -0,0 +1,74 @@
+/**
+ * @file benchmark_helper.h
+ *
+ * Wall clock micro-benchmarks for host-side performance comparisons.
+ * Numbers are printed for humans and CI logs, tests should never assert on them
+ * since build machines are noisy.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+struct BenchmarkResult {
+	double avgNs = 0;
+	double p50Ns = 0;
+	double p99Ns = 0;
+	double maxNs = 0;
+};
+
+/**
+ * Collects individually timed samples so that we get worst case and percentiles, not just average.
+ * Use directly when setup work has to happen between timed calls.
+ */
+class BenchmarkStats {
+public:
+	template <typename TFunc>
+	void measure(TFunc func) {
+		auto start = std::chrono::steady_clock::now();
+		func();
+		auto end = std::chrono::steady_clock::now();
+
+		samples.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+	}
+
+	BenchmarkResult report(const char *name) {
+		BenchmarkResult result;
+		int count = samples.size();
+
+		if (count > 0) {
+			std::sort(samples.begin(), samples.end());
+
+			double total = 0;
+			for (double sample : samples) {
+				total += sample;
+			}
+
+			result.avgNs = total / count;
+			result.p50Ns = samples[count / 2];
+			result.p99Ns = samples[count * 99 / 100];
+			result.maxNs = samples[count - 1];
+		}
+
+		printf("BENCHMARK %s: avg=%.1fns p50=%.1fns p99=%.1fns max=%.1fns (%d iterations)\n",
+			name, result.avgNs, result.p50Ns, result.p99Ns, result.maxNs, count);
+
+		return result;
+	}
+
+private:
+	std::vector<double> samples;
+};
+
+template <typename TFunc>
+BenchmarkResult runBenchmark(const char *name, int iterations, TFunc func) {
+	BenchmarkStats stats;
+
+	for (int i = 0; i < iterations; i++) {
+		stats.measure([&]() { func(i); });
+	}
+
+	return stats.report(name);
+}
@@ -396,3 +396,20 @@ void setVerboseTrigger(bool isEnabled) {
 	printTriggerDebug = isEnabled;
 	printTriggerTrace = isEnabled;
 }
+
+std::vector<std::pair<float, float>> getToothWindowsForUnitTest() {
+	TriggerCentral *tc = getTriggerCentral();
+	int count = tc->engineCycleEventCount;
+
+	std::vector<std::pair<float, float>> windows;
+	for (int i = 0; i < count; i++) {
+		angle_t current = wrapAngleMethod(tc->triggerFormDetails.eventAngles[i] - tdcPosition());
+		angle_t next = wrapAngleMethod(tc->triggerFormDetails.eventAngles[(i + 1) % count] - tdcPosition());
+		if (current == next) {
+			// rise/fall at the same angle, handleShaftSignal skips to the next distinct tooth
+			continue;
+		}
+		windows.push_back({ current, next });
+	}
+	return windows;
+}
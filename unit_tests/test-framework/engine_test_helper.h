@@ -13,6 +13,8 @@
 #include "engine.h"
 
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 extern EnginePins enginePins;
 
@@ -110,3 +112,8 @@ void setupSimpleTestEngineWithMafAndTT_ONE_trigger(EngineTestHelper *eth, inject
 void setupSimpleTestEngineWithMaf(EngineTestHelper *eth, injection_mode_e injectionMode, trigger_type_e trigger);
 
 void setVerboseTrigger(bool isEnabled);
+
+/**
+ * [currentPhase, nextPhase) pairs exactly as handleShaftSignal would pass them for one engine cycle of current trigger
+ */
+std::vector<std::pair<float, float>> getToothWindowsForUnitTest();
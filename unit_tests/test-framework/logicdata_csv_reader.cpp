@@ -59,34 +59,54 @@ double CsvReader::readTimestampAndValues(double *values) {
 	return timeStamp;
 }
 
-// todo: separate trigger handling from csv file processing
-void CsvReader::processLine(EngineTestHelper *eth) {
-	Engine *engine = &eth->engine;
-
+/**
+ * Parses current line without feeding it anywhere
+ * @return timestamp of current line in seconds, NAN at the end of file
+ */
+double CsvReader::readTimestampAndStates(bool *triggerState, bool *vvtState) {
 	const char s[2] = ",";
 	char *timeStampstr = trim(strtok(buffer, s));
 
-	bool newTriggerState[TRIGGER_INPUT_PIN_COUNT];
-	bool newVvtState[CAM_INPUTS_COUNT];
-
 	for (size_t i = 0;i<m_triggerCount;i++) {
 		char * triggerToken = trim(strtok(nullptr, s));
-		newTriggerState[triggerColumnIndeces[i]] = triggerToken[0] == '1';
+		triggerState[triggerColumnIndeces[i]] = triggerToken[0] == '1';
 	}
 
 	for (size_t i = 0;i<m_vvtCount;i++) {
 		char *vvtToken = trim(strtok(nullptr, s));
-		newVvtState[vvtColumnIndeces[i]] = vvtToken[0] == '1';
+		vvtState[vvtColumnIndeces[i]] = vvtToken[0] == '1';
 	}
 
 	if (timeStampstr == nullptr) {
 		criticalError("End of File");
-		return;
+		return NAN;
 	}
 
-	double timeStamp = std::stod(timeStampstr);
+	return std::stod(timeStampstr) + m_timestampOffset;
+}
 
-	timeStamp += m_timestampOffset;
+int CsvReader::getVvtInputIndex(size_t vvtIndex) const {
+	// todo: configurable selection of vvt mode - dual bank or dual cam single bank
+	int bankIndex;
+	int camIndex;
+	if (twoBanksSingleCamMode) {
+		bankIndex = vvtIndex;
+		camIndex = 0;
+	} else {
+		bankIndex = vvtIndex / 2;
+		camIndex = vvtIndex % 2;
+	}
+	return bankIndex * 2 + camIndex;
+}
+
+void CsvReader::processLine(EngineTestHelper *eth) {
+	bool newTriggerState[TRIGGER_INPUT_PIN_COUNT];
+	bool newVvtState[CAM_INPUTS_COUNT];
+
+	double timeStamp = readTimestampAndStates(newTriggerState, newVvtState);
+	if (std::isnan(timeStamp)) {
+		return;
+	}
 
 	eth->setTimeAndInvokeEventsUs(1'000'000 * timeStamp);
 	for (size_t index = 0; index < m_triggerCount; index++) {
@@ -113,17 +133,7 @@ void CsvReader::processLine(EngineTestHelper *eth) {
 
 		efitick_t nowNt = getTimeNowNt();
 		TriggerValue event = newVvtState[vvtIndex] ^ engineConfiguration->invertCamVVTSignal ? TriggerValue::RISE : TriggerValue::FALL;
-		// todo: configurable selection of vvt mode - dual bank or dual cam single bank
-		int bankIndex;
-		int camIndex;
-		if (twoBanksSingleCamMode) {
-			bankIndex = vvtIndex;
-			camIndex = 0;
-		} else {
-			bankIndex = vvtIndex / 2;
-			camIndex = vvtIndex % 2;
-		}
-		hwHandleVvtCamSignal(event, nowNt, bankIndex *2 + camIndex);
+		hwHandleVvtCamSignal(event, nowNt, getVvtInputIndex(vvtIndex));
 
 		currentVvtState[vvtIndex] = newVvtState[vvtIndex];
 
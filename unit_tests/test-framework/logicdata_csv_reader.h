@@ -5,6 +5,8 @@
  * @author Andrey Belomutskiy, (c) 2012-2021
  */
 
+#pragma once
+
 const int NORMAL_ORDER[2] = {0, 1};
 
 const int REVERSE_ORDER[2] = {1, 0};
@@ -29,6 +31,9 @@ public:
 	void processLine(EngineTestHelper *eth);
 	void readLine(EngineTestHelper *eth);
 	double readTimestampAndValues(double *v);
+	double readTimestampAndStates(bool *triggerState, bool *vvtState);
+	// index as expected by hwHandleVvtCamSignal
+	int getVvtInputIndex(size_t vvtIndex) const;
 
 	int lineIndex() const {
 		return m_lineIndex;
@@ -0,0 +1,70 @@
+/*
+ * @file tooth_log_decoder.cpp
+ */
+
+#include "pch.h"
+
+#include "tooth_log_decoder.h"
+
+static bool getVarint(const uint8_t* data, size_t size, size_t& offset, uint32_t& value) {
+	value = 0;
+	for (int shift = 0; shift < 7 * TOOTH_LOG_VARINT_MAX_SIZE; shift += 7) {
+		if (offset >= size) {
+			return false;
+		}
+		uint8_t byte = data[offset++];
+		value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+		if (!(byte & 0x80)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool decodeToothLogCompact(const uint8_t* data, size_t size, std::vector<composite_logger_s>& result) {
+	size_t offset = 0;
+	bool hasChunk = false;
+	uint32_t timestamp = 0;
+	uint8_t flags = 0;
+
+	while (offset < size) {
+		uint8_t mask = data[offset++];
+
+		if (mask == TOOTH_LOG_COMPACT_CHUNK_START) {
+			if (offset + 4 > size) {
+				return false;
+			}
+			timestamp = data[offset] | data[offset + 1] << 8 | data[offset + 2] << 16 | static_cast<uint32_t>(data[offset + 3]) << 24;
+			offset += 4;
+			flags = 0;
+			hasChunk = true;
+			continue;
+		}
+
+		if (!hasChunk || mask > 0x3F) {
+			return false;
+		}
+
+		uint32_t count;
+		if (!getVarint(data, size, offset, count)) {
+			return false;
+		}
+
+		for (uint32_t i = 0; i < count; i++) {
+			uint32_t zigzag;
+			if (!getVarint(data, size, offset, zigzag)) {
+				return false;
+			}
+			int32_t delta = static_cast<int32_t>(zigzag >> 1) ^ -static_cast<int32_t>(zigzag & 1);
+			timestamp += delta;
+			flags ^= mask;
+
+			composite_logger_s entry = {};
+			entry.timestamp = SWAP_UINT32(timestamp);
+			setToothLogFlags(entry, flags);
+			result.push_back(entry);
+		}
+	}
+
+	return true;
+}
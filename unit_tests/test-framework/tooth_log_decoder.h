@@ -0,0 +1,17 @@
+/*
+ * @file tooth_log_decoder.h
+ *
+ * Host side decoder for the compact tooth log, see tooth_log_compact.h
+ */
+
+#pragma once
+
+#include "tooth_log_compact.h"
+
+#include <vector>
+
+/**
+ * Decodes any number of concatenated chunks back into logger entries, timestamps in TS byte order
+ * @return false on malformed input, entries decoded so far are kept
+ */
+bool decodeToothLogCompact(const uint8_t* data, size_t size, std::vector<composite_logger_s>& result);
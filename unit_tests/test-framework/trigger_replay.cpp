@@ -0,0 +1,172 @@
+/*
+ * @file trigger_replay.cpp
+ */
+
+#include "pch.h"
+#include "trigger_replay.h"
+#include "trigger_emulator_algo.h"
+
+// quiet time between passes
+#define TRIGGER_REPLAY_PASS_GAP_US 100'000
+
+void TriggerCapture::loadCsv(const char *fileName, size_t triggerCount, size_t vvtCount,
+		const int *vvtColumnIndeces, bool twoBanksSingleCamMode) {
+	edges.clear();
+
+	CsvReader reader(triggerCount, vvtCount);
+	reader.twoBanksSingleCamMode = twoBanksSingleCamMode;
+	reader.open(fileName, NORMAL_ORDER, vvtColumnIndeces);
+
+	bool triggerState[TRIGGER_INPUT_PIN_COUNT] = {};
+	bool vvtState[CAM_INPUTS_COUNT] = {};
+
+	while (reader.haveMore()) {
+		bool newTriggerState[TRIGGER_INPUT_PIN_COUNT];
+		bool newVvtState[CAM_INPUTS_COUNT];
+		double timeStamp = reader.readTimestampAndStates(newTriggerState, newVvtState);
+		if (std::isnan(timeStamp)) {
+			break;
+		}
+
+		int timeUs = 1'000'000 * timeStamp;
+
+		for (size_t index = 0; index < triggerCount; index++) {
+			if (triggerState[index] != newTriggerState[index]) {
+				edges.push_back({ timeUs, false, (uint8_t)index, newTriggerState[index] });
+				triggerState[index] = newTriggerState[index];
+			}
+		}
+
+		for (size_t vvtIndex = 0; vvtIndex < vvtCount; vvtIndex++) {
+			if (vvtState[vvtIndex] != newVvtState[vvtIndex]) {
+				edges.push_back({ timeUs, true, (uint8_t)reader.getVvtInputIndex(vvtIndex), newVvtState[vvtIndex] });
+				vvtState[vvtIndex] = newVvtState[vvtIndex];
+			}
+		}
+	}
+}
+
+RpmRamp::RpmRamp(float startRpm, float endRpm, float crankDegrees)
+	: startSpeed(startRpm * 6.0)
+	, acceleration((endRpm * 6.0 * endRpm * 6.0 - startSpeed * startSpeed) / (2 * crankDegrees))
+{
+}
+
+double RpmRamp::getTime(double angle) const {
+	// same as speed * t + acceleration * t^2 / 2 solved for t, but fine with zero acceleration
+	return 2 * angle / (startSpeed + sqrt(startSpeed * startSpeed + 2 * acceleration * angle));
+}
+
+double RpmRamp::getAngle(double time) const {
+	return startSpeed * time + acceleration * time * time / 2;
+}
+
+double RpmRamp::getSpeed(double time) const {
+	return startSpeed + acceleration * time;
+}
+
+void TriggerCapture::synthesize(const TriggerWaveform& shape, int rpm, int cycleCount) {
+	synthesize(shape, RpmRamp(rpm, rpm, shape.getCycleDuration() * cycleCount), cycleCount);
+}
+
+void TriggerCapture::synthesize(const TriggerWaveform& shape, const RpmRamp& ramp, int cycleCount) {
+	edges.clear();
+
+	// getCycleDuration is in crank degrees
+	angle_t cycleDuration = shape.getCycleDuration();
+	const MultiChannelStateSequence& wave = shape.wave;
+
+	for (int cycle = 0; cycle < cycleCount; cycle++) {
+		for (int phaseIndex = 0; phaseIndex < wave.phaseCount; phaseIndex++) {
+			double angle = (cycle + wave.getSwitchTime(phaseIndex)) * cycleDuration;
+			int timeUs = round(1e6 * ramp.getTime(angle));
+
+			for (int channel = 0; channel < PWM_PHASE_MAX_WAVE_PER_PWM; channel++) {
+				if (needEvent(phaseIndex, wave, channel)) {
+					bool isRise = wave.getChannelState(channel, phaseIndex) == TriggerValue::RISE;
+					edges.push_back({ timeUs, false, (uint8_t)channel, isRise });
+				}
+			}
+		}
+	}
+}
+
+int TriggerCapture::getDurationUs() const {
+	if (edges.empty()) {
+		return 0;
+	}
+	return edges.back().timeUs - edges.front().timeUs;
+}
+
+TriggerReplayResult replayTriggerCapture(EngineTestHelper& eth, const char *name, const TriggerCapture& capture, int passCount) {
+	TriggerReplayResult result;
+	BenchmarkStats stats;
+	PrimaryTriggerDecoder& triggerState = getTriggerCentral()->triggerState;
+
+	if (capture.edges.empty()) {
+		return result;
+	}
+
+	int64_t passStartUs = eth.getTimeNowUs() + TRIGGER_REPLAY_PASS_GAP_US;
+	int64_t passDurationUs = capture.getDurationUs() + TRIGGER_REPLAY_PASS_GAP_US;
+	int firstEdgeUs = capture.edges.front().timeUs;
+
+	for (int pass = 0; pass < passCount; pass++) {
+		// unit test time is an int number of microseconds
+		if (passStartUs + passDurationUs > INT32_MAX) {
+			printf("%s: only %d of %d passes fit into unit test time\n", name, pass, passCount);
+			break;
+		}
+
+		triggerState.resetState();
+		bool wasSynchronized = false;
+
+		for (const auto& edge : capture.edges) {
+			eth.setTimeAndInvokeEventsUs((int)(passStartUs + edge.timeUs - firstEdgeUs));
+			efitick_t nowNt = getTimeNowNt();
+
+			if (edge.isCam) {
+				TriggerValue event = edge.value ^ engineConfiguration->invertCamVVTSignal ? TriggerValue::RISE : TriggerValue::FALL;
+				hwHandleVvtCamSignal(event, nowNt, edge.index);
+			} else {
+				bool state = edge.value ^ (edge.index == 0 ? engineConfiguration->invertPrimaryTriggerSignal : engineConfiguration->invertSecondaryTriggerSignal);
+				stats.measure([&]() {
+					hwHandleShaftSignal(edge.index, state, nowNt);
+				});
+				result.edgeCount++;
+			}
+
+			bool isSynchronized = triggerState.getShaftSynchronized();
+			if (wasSynchronized && !isSynchronized) {
+				result.syncLossCount++;
+			}
+			wasSynchronized = isSynchronized;
+		}
+
+		// counters are cleared by the reset at the start of next pass
+		result.triggerErrorCount += triggerState.totalTriggerErrorCounter;
+		result.orderingErrorCount += triggerState.orderingErrorCounter;
+
+		passStartUs += passDurationUs;
+	}
+
+	result.perEdge = stats.report(name);
+	if (result.perEdge.avgNs > 0) {
+		result.edgesPerSecond = 1e9 / result.perEdge.avgNs;
+	}
+
+	printf("BENCHMARK %s: %.0f edges/s, %d sync losses, %u trigger errors, %u ordering errors\n",
+		name, result.edgesPerSecond, result.syncLossCount, result.triggerErrorCount, result.orderingErrorCount);
+
+	return result;
+}
+
+int getTriggerReplayPassCount(int defaultValue) {
+	const char *value = getenv("RUSEFI_TRIGGER_REPLAY_PASSES");
+	if (value == nullptr) {
+		return defaultValue;
+	}
+
+	int passCount = atoi(value);
+	return passCount > 0 ? passCount : defaultValue;
+}
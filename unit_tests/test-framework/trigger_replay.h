@@ -0,0 +1,75 @@
+/*
+ * @file trigger_replay.h
+ *
+ * Replays trigger captures loaded into memory so that decoder hot path cost can be measured
+ * without csv parsing in the numbers.
+ */
+
+#pragma once
+
+#include "benchmark_helper.h"
+#include "logicdata_csv_reader.h"
+
+struct TriggerReplayEdge {
+	int timeUs;
+	bool isCam;
+	// trigger input index or hwHandleVvtCamSignal index
+	uint8_t index;
+	// electrical level, inversion settings are applied during replay same as CsvReader does
+	bool value;
+};
+
+/**
+ * Crankshaft turning with constant angular acceleration, RPM changing linearly in time
+ */
+struct RpmRamp {
+	RpmRamp(float startRpm, float endRpm, float crankDegrees);
+
+	// seconds since start of the ramp to get to 'angle' crank degrees
+	double getTime(double angle) const;
+	double getAngle(double time) const;
+	// degrees per second
+	double getSpeed(double time) const;
+
+	double startSpeed;
+	double acceleration;
+};
+
+class TriggerCapture {
+public:
+	/**
+	 * Recorded logic analyzer export, same column layout as CsvReader
+	 */
+	void loadCsv(const char *fileName, size_t triggerCount, size_t vvtCount,
+			const int *vvtColumnIndeces = NORMAL_ORDER, bool twoBanksSingleCamMode = true);
+	/**
+	 * Ideal signal for the given trigger shape at constant RPM
+	 */
+	void synthesize(const TriggerWaveform& shape, int rpm, int cycleCount);
+	void synthesize(const TriggerWaveform& shape, const RpmRamp& ramp, int cycleCount);
+
+	int getDurationUs() const;
+
+	std::vector<TriggerReplayEdge> edges;
+};
+
+struct TriggerReplayResult {
+	size_t edgeCount = 0;
+	double edgesPerSecond = 0;
+	// decoder went from synchronized to not synchronized
+	int syncLossCount = 0;
+	uint32_t triggerErrorCount = 0;
+	uint32_t orderingErrorCount = 0;
+	BenchmarkResult perEdge;
+};
+
+/**
+ * Feeds the capture to the trigger input handlers 'passCount' times, timing each shaft edge.
+ * Every pass starts from a reset trigger decoder just like the original recording did.
+ */
+TriggerReplayResult replayTriggerCapture(EngineTestHelper& eth, const char *name, const TriggerCapture& capture, int passCount);
+
+/**
+ * RUSEFI_TRIGGER_REPLAY_PASSES environment variable allows long runs without slowing down regular unit tests
+ */
+int getTriggerReplayPassCount(int defaultValue);
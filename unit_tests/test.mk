@@ -1,6 +1,8 @@
 FRAMEWORK_SRC_CPP = test-framework/unit_test_framework.cpp \
 	test-framework/engine_test_helper.cpp \
 	test-framework/logicdata_csv_reader.cpp \
+	test-framework/trigger_replay.cpp \
+	test-framework/tooth_log_decoder.cpp \
 	boards.cpp \
 	test-framework/global_execution_queue.cpp \
 	test_basic_math/test_find_index.cpp \
@@ -0,0 +1,142 @@
+/*
+ * @file test_phase_dispatch.cpp
+ *
+ * Per-tooth ignition/injection dispatch: only cylinders with an event near current tooth are visited
+ */
+
+#include "pch.h"
+#include "spark_logic.h"
+
+#include "benchmark_helper.h"
+
+#include <random>
+
+TEST(PhaseDispatchTable, candidates) {
+	PhaseDispatchTable table;
+
+	EXPECT_EQ(0u, table.getCandidates(0, 720));
+
+	table.setPhase(0, 10);
+	table.setPhase(1, 100);
+	table.setPhase(2, 715);
+
+	EXPECT_EQ(1u << 0, table.getCandidates(5, 15));
+	EXPECT_EQ(1u << 1, table.getCandidates(95, 105));
+	EXPECT_EQ(0u, table.getCandidates(300, 330));
+
+	// window wrapping around the end of engine cycle
+	EXPECT_EQ((1u << 0) | (1u << 2), table.getCandidates(700, 12));
+
+	// angle moved to another bucket
+	table.setPhase(1, 300);
+	EXPECT_EQ(0u, table.getCandidates(95, 105));
+	EXPECT_EQ(1u << 1, table.getCandidates(295, 305));
+
+	// NaN angle means the event is not scheduled at all
+	table.setPhase(0, NAN);
+	EXPECT_EQ(0u, table.getCandidates(5, 15));
+}
+
+/**
+ * Dispatch table may report extra candidates but never miss an event which isPhaseInRange would accept
+ */
+TEST(PhaseDispatchTable, neverMissesEvent) {
+	static constexpr int count = 12;
+	float angles[count];
+	PhaseDispatchTable table;
+
+	std::mt19937 rng(4242);
+	std::uniform_real_distribution<float> phase(0, 720);
+
+	for (int i = 0; i < count; i++) {
+		angles[i] = phase(rng);
+		table.setPhase(i, angles[i]);
+	}
+
+	for (int step = 0; step < 20000; step++) {
+		int index = rng() % count;
+		angles[index] = phase(rng);
+		table.setPhase(index, angles[index]);
+
+		float currentPhase = phase(rng);
+		float nextPhase = wrapAngleMethod(currentPhase + (rng() % 90));
+
+		uint32_t candidates = table.getCandidates(currentPhase, nextPhase);
+		for (int i = 0; i < count; i++) {
+			if (isPhaseInRange(angles[i], currentPhase, nextPhase)) {
+				ASSERT_TRUE(candidates & (1u << i)) << "step " << step << " event " << i;
+			}
+		}
+	}
+}
+
+static const trigger_type_e redlineTriggers[] = {
+	trigger_type_e::TT_TOOTHED_WHEEL_60_2,
+	trigger_type_e::TT_TOOTHED_WHEEL_36_1,
+};
+
+struct RedlineDispatchResult {
+	BenchmarkResult perTooth;
+	int visited = 0;
+};
+
+static RedlineDispatchResult benchmarkRedlineDispatch(trigger_type_e type, bool fullScan) {
+	static constexpr int rpm = 8000;
+	static constexpr int cycles = 200;
+
+	// twelve cylinders is the worst case for a per-tooth loop over all cylinders
+	EngineTestHelper eth(engine_type_e::FRANKENSO_BMW_M73_F);
+	eth.setTriggerType(type);
+	engine->rpmCalculator.setRpmValue(rpm);
+
+	setArrayValues(engine->engineState.timingAdvance, 10.0f);
+	initializeIgnitionActions();
+	engine->injectionEvents.addFuelEvents();
+	EXPECT_TRUE(engine->ignitionEvents.isReady);
+
+	PhaseDispatchTable& dwellDispatch = engine->ignitionEvents.dwellDispatch;
+	PhaseDispatchTable& injectionDispatch = engine->injectionEvents.injectionDispatch;
+	dwellDispatch.fullScanForUnitTest = fullScan;
+	injectionDispatch.fullScanForUnitTest = fullScan;
+
+	auto windows = getToothWindowsForUnitTest();
+	uint32_t cylinderMask = (1U << engineConfiguration->cylindersCount) - 1;
+
+	RedlineDispatchResult result;
+	BenchmarkStats stats;
+	efitick_t nowNt = getTimeNowNt();
+
+	for (int cycle = 0; cycle < cycles; cycle++) {
+		for (auto& window : windows) {
+			result.visited += __builtin_popcount(dwellDispatch.getCandidates(window.first, window.second) & cylinderMask);
+			result.visited += __builtin_popcount(injectionDispatch.getCandidates(window.first, window.second) & cylinderMask);
+
+			stats.measure([&]() {
+				onTriggerEventSparkLogic(rpm, nowNt, window.first, window.second);
+				engine->injectionEvents.onTriggerTooth(rpm, nowNt, window.first, window.second);
+			});
+		}
+
+		// whatever got scheduled is not the point of this benchmark
+		eth.clearQueue();
+	}
+
+	char title[96];
+	snprintf(title, sizeof(title), "per-tooth dispatch %s trigger=%d teeth=%d rpm=%d",
+		fullScan ? "full scan" : "phase table", (int)type, (int)windows.size(), rpm);
+	result.perTooth = stats.report(title);
+	return result;
+}
+
+TEST(PhaseDispatchTable, benchmarkRedline) {
+	for (trigger_type_e type : redlineTriggers) {
+		// same engine and teeth, the only difference is which cylinders each tooth looks at
+		RedlineDispatchResult before = benchmarkRedlineDispatch(type, /* fullScan */ true);
+		RedlineDispatchResult after = benchmarkRedlineDispatch(type, /* fullScan */ false);
+
+		EXPECT_TRUE(after.visited * 4 < before.visited) << "visited " << after.visited << " of " << before.visited;
+
+		printf("BENCHMARK per-tooth dispatch trigger=%d: full scan avg=%.1fns, phase table avg=%.1fns, saved %.1fns per tooth\n",
+			(int)type, before.perTooth.avgNs, after.perTooth.avgNs, before.perTooth.avgNs - after.perTooth.avgNs);
+	}
+}
@@ -48,3 +48,67 @@ TEST(CanFilterTest, orderOfBusinessTwo) {
 	ASSERT_EQ(CALLBACK_ALL, getFilterForId(/*bus*/0, /*id*/ 0)->Callback);
 	ASSERT_EQ(CALLBACK_239, getFilterForId(/*bus*/0, /*id*/ 239)->Callback);
 }
+
+TEST(CanFilterTest, sameIdDifferentBus) {
+	resetLuaCanRx();
+
+	addLuaCanRxFilter(/*eid*/0x100, FILTER_SPECIFIC, /*bus*/1, 11);
+	addLuaCanRxFilter(/*eid*/0x100, FILTER_SPECIFIC, /*bus*/0, 10);
+	addLuaCanRxFilter(/*eid*/0x100, FILTER_SPECIFIC, ANY_BUS, 12);
+
+	ASSERT_EQ(10, getFilterForId(/*bus*/0, /*id*/ 0x100)->Callback);
+	ASSERT_EQ(11, getFilterForId(/*bus*/1, /*id*/ 0x100)->Callback);
+	ASSERT_EQ(12, getFilterForId(/*bus*/2, /*id*/ 0x100)->Callback);
+	ASSERT_EQ(nullptr, getFilterForId(/*bus*/0, /*id*/ 0x101));
+}
+
+TEST(CanFilterTest, maskedBeforeExact) {
+	resetLuaCanRx();
+
+	// 0x200..0x20F
+	addLuaCanRxFilter(/*eid*/0x200, 0x7F0, ANY_BUS, 20);
+	addLuaCanRxFilter(/*eid*/0x205, FILTER_SPECIFIC, ANY_BUS, 21);
+	addLuaCanRxFilter(/*eid*/0x300, FILTER_SPECIFIC, ANY_BUS, 30);
+	addLuaCanRxFilter(/*eid*/0x300, 0x700, ANY_BUS, 31);
+
+	ASSERT_EQ(20, getFilterForId(/*bus*/0, /*id*/ 0x205)->Callback);
+	ASSERT_EQ(20, getFilterForId(/*bus*/0, /*id*/ 0x20F)->Callback);
+	ASSERT_EQ(30, getFilterForId(/*bus*/0, /*id*/ 0x300)->Callback);
+	ASSERT_EQ(31, getFilterForId(/*bus*/0, /*id*/ 0x3AB)->Callback);
+	ASSERT_EQ(nullptr, getFilterForId(/*bus*/0, /*id*/ 0x210));
+}
+
+/**
+ * Hash lookup has to pick exactly the filter a first-match scan in order of addition would pick
+ */
+TEST(CanFilterTest, matchesLinearScan) {
+	resetLuaCanRx();
+
+	std::vector<CanFilter> reference;
+	for (int i = 0; i < 48; i++) {
+		CanFilter filter;
+		// a few masked ranges among many exact IDs, some IDs repeat on different buses
+		filter.Id = (i % 7 == 0) ? 0x400 + (i << 4) : 0x100 + (i % 30) * 3;
+		filter.Mask = (i % 7 == 0) ? 0x7F0 : FILTER_SPECIFIC;
+		filter.Bus = (i % 3 == 0) ? ANY_BUS : i % 2;
+		filter.Callback = i;
+
+		addLuaCanRxFilter(filter.Id, filter.Mask, filter.Bus, filter.Callback);
+		reference.push_back(filter);
+	}
+
+	for (size_t bus = 0; bus < 3; bus++) {
+		for (int id = 0; id < 0x800; id++) {
+			int expected = NO_CALLBACK - 1;
+			for (auto& filter : reference) {
+				if (filter.accept(id) && (filter.Bus == ANY_BUS || filter.Bus == (int)bus)) {
+					expected = filter.Callback;
+					break;
+				}
+			}
+
+			CanFilter *actual = getFilterForId(bus, id);
+			ASSERT_EQ(expected, actual ? actual->Callback : NO_CALLBACK - 1) << "bus " << bus << " id " << id;
+		}
+	}
+}
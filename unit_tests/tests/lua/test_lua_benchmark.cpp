@@ -0,0 +1,76 @@
+/*
+ * @file test_lua_benchmark.cpp
+ *
+ * Cost of Lua hooks as seen by a script, name lookup vs pre-resolved handles
+ */
+
+#include "pch.h"
+#include "rusefi_lua.h"
+#include "benchmark_helper.h"
+
+static constexpr int callsPerRun = 10000;
+
+static void benchmarkScript(const char *name, const char *script) {
+	BenchmarkStats stats;
+	for (int run = 0; run < 10; run++) {
+		stats.measure([&]() {
+			EXPECT_EQ(testLuaReturnsNumber(script), 33 * callsPerRun);
+		});
+	}
+
+	BenchmarkResult result = stats.report(name);
+	printf("BENCHMARK %s: %.0f calls/s\n", name, callsPerRun / (result.p50Ns * 1e-9));
+}
+
+TEST(LuaBenchmark, getSensor) {
+	Sensor::setMockValue((int)SensorType::Clt, 33);
+
+	benchmarkScript("Lua getSensor by name", R"(
+	function testFunc()
+		local sum = 0
+		for i = 1, 10000 do
+			sum = sum + getSensor("CLT")
+		end
+		return sum
+	end
+	)");
+
+	benchmarkScript("Lua getSensor by handle", R"(
+	local clt = getSensorHandle("CLT")
+
+	function testFunc()
+		local sum = 0
+		for i = 1, 10000 do
+			sum = sum + getSensorByIndex(clt)
+		end
+		return sum
+	end
+	)");
+}
+
+TEST(LuaBenchmark, getCalibration) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	engineConfiguration->maxAcClt = 33;
+
+	benchmarkScript("Lua getCalibration by name", R"(
+	function testFunc()
+		local sum = 0
+		for i = 1, 10000 do
+			sum = sum + getCalibration("maxAcClt")
+		end
+		return sum
+	end
+	)");
+
+	benchmarkScript("Lua getCalibration by handle", R"(
+	local maxAcClt = getCalibrationHandle("maxAcClt")
+
+	function testFunc()
+		local sum = 0
+		for i = 1, 10000 do
+			sum = sum + getCalibrationByHandle(maxAcClt)
+		end
+		return sum
+	end
+	)");
+}
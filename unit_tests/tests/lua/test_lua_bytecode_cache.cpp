@@ -0,0 +1,115 @@
+/*
+ * @file test_lua_bytecode_cache.cpp
+ *
+ * Script restart from cached bytecode: cache hit/miss rules and compile vs load time.
+ */
+
+#include "pch.h"
+#include "lua.hpp"
+#include "lua_lib.h"
+#include "lua_bytecode_cache.h"
+#include "benchmark_helper.h"
+
+static int loadAndRun(LuaBytecodeCache& cache, const char* script) {
+	lua_State* ls = luaL_newstate();
+	luaL_requiref(ls, LUA_MATHLIBNAME, luaopen_math, 1);
+	lua_pop(ls, 1);
+
+	int result = -1;
+	if (cache.load(ls, script, strlen(script)) == LUA_OK && lua_pcall(ls, 0, 1, 0) == LUA_OK) {
+		result = lua_tointeger(ls, -1);
+	}
+
+	lua_close(ls);
+	return result;
+}
+
+TEST(LuaBytecodeCache, hitOnSameScript) {
+	static uint8_t buffer[4000];
+	LuaBytecodeCache cache(buffer, sizeof(buffer));
+
+	const char* script = "local x = 3 return x * 4";
+
+	EXPECT_EQ(12, loadAndRun(cache, script));
+	EXPECT_FALSE(cache.wasLastLoadCached());
+	EXPECT_TRUE(cache.getBytecodeSize() > 0);
+
+	EXPECT_EQ(12, loadAndRun(cache, script));
+	EXPECT_TRUE(cache.wasLastLoadCached());
+	EXPECT_EQ(1u, cache.getHitCount());
+
+	// any change to the text has to be recompiled
+	EXPECT_EQ(15, loadAndRun(cache, "local x = 3 return x * 5"));
+	EXPECT_FALSE(cache.wasLastLoadCached());
+	EXPECT_EQ(1u, cache.getHitCount());
+
+	cache.invalidate();
+	EXPECT_EQ(15, loadAndRun(cache, "local x = 3 return x * 5"));
+	EXPECT_FALSE(cache.wasLastLoadCached());
+}
+
+TEST(LuaBytecodeCache, doesNotFit) {
+	static uint8_t buffer[16];
+	LuaBytecodeCache cache(buffer, sizeof(buffer));
+
+	const char* script = "return 42";
+
+	EXPECT_EQ(42, loadAndRun(cache, script));
+	EXPECT_EQ(0u, cache.getBytecodeSize());
+
+	EXPECT_EQ(42, loadAndRun(cache, script));
+	EXPECT_FALSE(cache.wasLastLoadCached());
+	EXPECT_EQ(0u, cache.getHitCount());
+}
+
+TEST(LuaBytecodeCache, syntaxError) {
+	static uint8_t buffer[4000];
+	LuaBytecodeCache cache(buffer, sizeof(buffer));
+
+	lua_State* ls = luaL_newstate();
+	EXPECT_NE(LUA_OK, cache.load(ls, "return (", 8));
+	// line numbers refer to the script, not to the whole text
+	EXPECT_NE(nullptr, strstr(lua_tostring(ls, -1), "script:1:"));
+	EXPECT_EQ(0u, cache.getBytecodeSize());
+	lua_close(ls);
+}
+
+static const char* canScript = PRINT_ARRAY TWO_BYTES_LSB SET_TWO_BYTES_LSB VAG_CHECKSUM R"(
+	lastFrames = {}
+
+	function onCanRx(bus, id, dlc, data)
+		local rpm = getTwoBytesLSB(data, 2, 0.25)
+		local out = { 0, 0, 0, 0, 0, 0, 0, 0 }
+		setTwoBytesLsb(out, 2, rpm * 4)
+		xorChecksum(out, 1)
+		lastFrames[id % 8 + 1] = arrayToString(out)
+	end
+
+	return 7
+)";
+
+TEST(LuaBytecodeCache, benchmarkCompileVsCached) {
+	static uint8_t buffer[16000];
+	LuaBytecodeCache cache(buffer, sizeof(buffer));
+	size_t length = strlen(canScript);
+
+	lua_State* ls = luaL_newstate();
+
+	runBenchmark("Lua script load, compile", 500, [&](int) {
+		cache.invalidate();
+		cache.load(ls, canScript, length);
+		lua_settop(ls, 0);
+	});
+
+	runBenchmark("Lua script load, cached bytecode", 500, [&](int) {
+		cache.load(ls, canScript, length);
+		lua_settop(ls, 0);
+	});
+
+	printf("Lua script: %d bytes of text, %d bytes of bytecode\n", (int)length, (int)cache.getBytecodeSize());
+	lua_close(ls);
+
+	EXPECT_EQ(500u, cache.getHitCount());
+	EXPECT_EQ(7, loadAndRun(cache, canScript));
+	EXPECT_TRUE(cache.wasLastLoadCached());
+}
@@ -85,6 +85,44 @@ TEST(LuaHooks, TestGetSensorByName) {
 	EXPECT_EQ(testLuaReturnsNumberOrNil(getSensorTestByName).value_or(0), 33);
 }
 
+TEST(LuaHooks, TestGetSensorByHandle) {
+	const char* getSensorTestByHandle = R"(
+
+	local clt = getSensorHandle("CLT")
+
+	function testFunc()
+		return getSensorByIndex(clt)
+	end
+
+	)";
+
+	Sensor::resetMockValue(SensorType::Clt);
+	EXPECT_EQ(testLuaReturnsNumberOrNil(getSensorTestByHandle), unexpected);
+
+	Sensor::setMockValue((int)SensorType::Clt, 33);
+	EXPECT_EQ(testLuaReturnsNumberOrNil(getSensorTestByHandle).value_or(0), 33);
+
+	// bad name is reported when resolving, not on every call
+	EXPECT_ANY_THROW(testLuaExecString("getSensorHandle(\"NotASensor\")"));
+}
+
+TEST(LuaHooks, TestGetCalibrationByHandle) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	const char* sourceCode = R"(
+
+	local crankingRpm = getCalibrationHandle("cranking.rpm")
+
+	function testFunc()
+		setCalibration("cranking.rpm", 700, false)
+		return getCalibrationByHandle(crankingRpm)
+	end
+
+	)";
+	EXPECT_EQ(testLuaReturnsNumber(sourceCode), 700);
+
+	EXPECT_ANY_THROW(testLuaExecString("getCalibrationHandle(\"notACalibration\")"));
+}
+
 TEST(LuaHooks, Table3d) {
 	const char* tableTest = R"(
 	function testFunc()
@@ -214,3 +252,62 @@ end
 TEST(LuaHooks, LuaPid) {
 	EXPECT_EQ(testLuaReturnsNumber(pidTest), 0);
 }
+
+TEST(LuaHooks, HookStats) {
+	LuaHookStats stats;
+	stats.reset("test");
+	EXPECT_EQ(0, stats.getMinUs());
+	EXPECT_EQ(0, stats.getAvgUs());
+
+	stats.add(30);
+	stats.add(10);
+	stats.add(20);
+
+	EXPECT_EQ(3, stats.getCount());
+	EXPECT_EQ(10, stats.getMinUs());
+	EXPECT_EQ(20, stats.getAvgUs());
+	EXPECT_EQ(30, stats.getMaxUs());
+}
+
+static int callGlobal(LuaHandle& ls, const char* name) {
+	lua_getglobal(ls, name);
+	int status = luaCallHook(ls, LuaHookType::Tick, 0);
+	lua_settop(ls, 0);
+	return status;
+}
+
+TEST(LuaHooks, InstructionBudget) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	resetLuaHookStats();
+
+	LuaHandle ls = luaL_newstate();
+	ASSERT_EQ(0, luaL_dostring(ls, R"(
+	function runaway()
+		while true do end
+	end
+
+	function bounded()
+		local x = 0
+		for i = 1, 100000 do
+			x = x + i
+		end
+	end
+	)"));
+
+	// no budget: long running hook completes
+	engineConfiguration->luaHookBudget = 0;
+	EXPECT_EQ(0, callGlobal(ls, "bounded"));
+	EXPECT_EQ(0, getLuaHookBudgetAborts());
+
+	engineConfiguration->luaHookBudget = 20;
+	EXPECT_NE(0, callGlobal(ls, "runaway"));
+	EXPECT_EQ(1, getLuaHookBudgetAborts());
+
+	// budget is per call, not cumulative
+	engineConfiguration->luaHookBudget = 1000;
+	EXPECT_EQ(0, callGlobal(ls, "bounded"));
+	EXPECT_EQ(0, callGlobal(ls, "bounded"));
+	EXPECT_EQ(1, getLuaHookBudgetAborts());
+
+	EXPECT_EQ(4, getLuaHookStats(LuaHookType::Tick).getCount());
+}
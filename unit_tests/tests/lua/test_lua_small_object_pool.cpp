@@ -0,0 +1,297 @@
+/*
+ * @file test_lua_small_object_pool.cpp
+ *
+ * Size class pool for the Lua heap: block reuse, growing by chunks, and a replay of the allocation trace
+ * of a CAN processing script.
+ */
+
+#include "pch.h"
+#include "lua.hpp"
+#include "lua_lib.h"
+#include "lua_small_object_pool.h"
+#include "benchmark_helper.h"
+
+#include <map>
+
+TEST(LuaSmallObjectPool, reuseAndGrow) {
+	alignas(8) static char chunk[256];
+	alignas(8) static char secondChunk[64];
+	LuaSmallObjectPool pool;
+	pool.reset();
+
+	EXPECT_TRUE(LuaSmallObjectPool::isSmall(128));
+	EXPECT_FALSE(LuaSmallObjectPool::isSmall(129));
+	EXPECT_EQ(48u, LuaSmallObjectPool::getBlockSize(33));
+
+	// too large for the pool
+	EXPECT_EQ(nullptr, pool.alloc(129));
+	// nothing reserved until the first chunk arrives
+	EXPECT_EQ(nullptr, pool.alloc(10));
+	EXPECT_EQ(0u, pool.getSize());
+
+	pool.addChunk(chunk, sizeof(chunk));
+
+	void* a = pool.alloc(10);
+	void* b = pool.alloc(16);
+	ASSERT_NE(nullptr, a);
+	ASSERT_NE(nullptr, b);
+	EXPECT_EQ(32u, pool.getCarvedBytes());
+	EXPECT_EQ(6u, pool.getSlackBytes());
+
+	EXPECT_TRUE(pool.canResizeInPlace(10, 16));
+	EXPECT_FALSE(pool.canResizeInPlace(10, 17));
+
+	pool.free(a, 10);
+	EXPECT_EQ(16u, pool.getIdleBytes());
+	// same size class gets the freed block back without carving
+	EXPECT_EQ(a, pool.alloc(12));
+	EXPECT_EQ(32u, pool.getCarvedBytes());
+
+	// 32 carved, 128 + 64 more leaves 32
+	ASSERT_NE(nullptr, pool.alloc(128));
+	ASSERT_NE(nullptr, pool.alloc(60));
+	EXPECT_EQ(224u, pool.getCarvedBytes());
+
+	// chunk is out of space for this size class, owner has to grow the pool
+	EXPECT_EQ(nullptr, pool.alloc(40));
+	pool.addChunk(secondChunk, sizeof(secondChunk));
+	EXPECT_EQ(2u, pool.getChunkCount());
+	EXPECT_EQ(320u, pool.getSize());
+	// tail of the first chunk went to the free lists
+	EXPECT_EQ(32u, pool.getIdleBytes());
+	EXPECT_EQ(chunk + 224, pool.alloc(20));
+
+	void* c = pool.alloc(40);
+	EXPECT_TRUE(c >= secondChunk && c < secondChunk + sizeof(secondChunk));
+
+	auto stats = pool.getClassStats(0);
+	EXPECT_EQ(16u, stats.blockSize);
+	EXPECT_EQ(2u, stats.inUse);
+	EXPECT_EQ(2u, stats.highWater);
+	EXPECT_EQ(0u, stats.idle);
+}
+
+namespace {
+
+// one call to lua_Alloc, blocks are identified by the order in which they were allocated
+struct AllocRecord {
+	int block;
+	size_t oldSize;
+	size_t newSize;
+};
+
+struct TraceRecorder {
+	std::vector<AllocRecord> trace;
+	std::map<void*, int> blockByPointer;
+	int nextBlock = 0;
+
+	static void* alloc(void* ud, void* ptr, size_t osize, size_t nsize) {
+		auto self = reinterpret_cast<TraceRecorder*>(ud);
+
+		int block;
+		if (ptr) {
+			block = self->blockByPointer[ptr];
+			self->blockByPointer.erase(ptr);
+		} else if (nsize == 0) {
+			return nullptr;
+		} else {
+			block = self->nextBlock++;
+			osize = 0;
+		}
+		self->trace.push_back({ block, osize, nsize });
+
+		if (nsize == 0) {
+			free(ptr);
+			return nullptr;
+		}
+		void* result = realloc(ptr, nsize);
+		self->blockByPointer[result] = block;
+		return result;
+	}
+};
+
+// pool growing over the general heap, same as the firmware Lua heap does it
+struct PoolOverHeap {
+	LuaSmallObjectPool pool;
+	std::vector<void*> chunks;
+	size_t used = 0;
+
+	~PoolOverHeap() {
+		reset();
+	}
+
+	void reset() {
+		for (auto chunk : chunks) {
+			free(chunk);
+		}
+		chunks.clear();
+		pool.reset();
+	}
+
+	void* alloc(size_t nsize) {
+		if (!LuaSmallObjectPool::isSmall(nsize)) {
+			return malloc(nsize);
+		}
+		void* result = pool.alloc(nsize);
+		if (!result) {
+			chunks.push_back(aligned_alloc(16, 512));
+			pool.addChunk(chunks.back(), 512);
+			result = pool.alloc(nsize);
+		}
+		return result;
+	}
+
+	void* realloc(void* ptr, size_t osize, size_t nsize) {
+		if (nsize == 0) {
+			release(ptr, osize);
+			return nullptr;
+		}
+		if (ptr && LuaSmallObjectPool::isSmall(osize) && pool.canResizeInPlace(osize, nsize)) {
+			pool.onResizedInPlace(osize, nsize);
+			used += nsize - osize;
+			return ptr;
+		}
+		void* result = alloc(nsize);
+		if (ptr) {
+			memcpy(result, ptr, std::min(osize, nsize));
+			release(ptr, osize);
+		}
+		used += nsize;
+		return result;
+	}
+
+	void release(void* ptr, size_t osize) {
+		if (!ptr) {
+			return;
+		}
+		if (LuaSmallObjectPool::isSmall(osize)) {
+			pool.free(ptr, osize);
+		} else {
+			free(ptr);
+		}
+		used -= osize;
+	}
+
+	static void* luaAlloc(void* ud, void* ptr, size_t osize, size_t nsize) {
+		return reinterpret_cast<PoolOverHeap*>(ud)->realloc(ptr, ptr ? osize : 0, nsize);
+	}
+};
+
+}
+
+// typical CAN gateway: decode, re-encode with checksum, keep a printable copy
+static const char* canScript = PRINT_ARRAY TWO_BYTES_LSB SET_TWO_BYTES_LSB VAG_CHECKSUM R"(
+	lastFrames = {}
+
+	function onCanRx(bus, id, dlc, data)
+		local rpm = getTwoBytesLSB(data, 2, 0.25)
+		local out = { 0, 0, 0, 0, 0, 0, 0, 0 }
+		setTwoBytesLsb(out, 2, rpm * 4)
+		xorChecksum(out, 1)
+		lastFrames[id % 8 + 1] = arrayToString(out)
+	end
+
+	function testFunc()
+		for i = 1, 2000 do
+			onCanRx(0, 0x280 + i % 16, 8, { i % 256, 0, i % 256, (i >> 8) % 256, 0, 0, 0, 0 })
+		end
+		return #lastFrames
+	end
+)";
+
+static void runCanScript(lua_State* ls) {
+	luaL_requiref(ls, LUA_MATHLIBNAME, luaopen_math, 1);
+	lua_pop(ls, 1);
+
+	ASSERT_EQ(0, luaL_dostring(ls, canScript));
+	lua_getglobal(ls, "testFunc");
+	ASSERT_EQ(0, lua_pcall(ls, 0, 1, 0));
+	EXPECT_EQ(8, lua_tointeger(ls, -1));
+	lua_settop(ls, 0);
+}
+
+static std::vector<AllocRecord> recordCanScriptTrace() {
+	TraceRecorder recorder;
+	lua_State* ls = lua_newstate(TraceRecorder::alloc, &recorder);
+	runCanScript(ls);
+	lua_close(ls);
+	return recorder.trace;
+}
+
+TEST(LuaSmallObjectPool, runsScript) {
+	PoolOverHeap heap;
+	heap.pool.reset();
+
+	lua_State* ls = lua_newstate(PoolOverHeap::luaAlloc, &heap);
+	runCanScript(ls);
+	lua_close(ls);
+
+	EXPECT_EQ(0u, heap.used);
+	EXPECT_EQ(0u, heap.pool.getSlackBytes());
+	for (size_t i = 0; i < heap.pool.getClassCount(); i++) {
+		EXPECT_EQ(0u, heap.pool.getClassStats(i).inUse);
+	}
+}
+
+template <typename TRealloc>
+static void replay(const std::vector<AllocRecord>& trace, std::vector<void*>& blocks, TRealloc doRealloc) {
+	for (auto& record : trace) {
+		if (record.block >= (int)blocks.size()) {
+			blocks.resize(record.block + 1);
+		}
+		blocks[record.block] = doRealloc(blocks[record.block], record.oldSize, record.newSize);
+	}
+}
+
+TEST(LuaSmallObjectPool, benchmarkTraceReplay) {
+	auto trace = recordCanScriptTrace();
+	ASSERT_TRUE(trace.size() > 1000);
+
+	int smallCount = 0;
+	for (auto& record : trace) {
+		if (record.newSize != 0 && record.newSize <= LuaSmallObjectPool::maxBlockSize) {
+			smallCount++;
+		}
+	}
+	printf("Lua trace: %d allocator calls, %d small allocations\n", (int)trace.size(), smallCount);
+
+	std::vector<void*> blocks;
+
+	BenchmarkStats mallocStats;
+	for (int run = 0; run < 20; run++) {
+		mallocStats.measure([&]() {
+			replay(trace, blocks, [](void* ptr, size_t, size_t nsize) -> void* {
+				if (nsize == 0) {
+					free(ptr);
+					return nullptr;
+				}
+				return realloc(ptr, nsize);
+			});
+		});
+	}
+	mallocStats.report("Lua trace replay, malloc");
+
+	PoolOverHeap heap;
+	BenchmarkStats poolStats;
+	for (int run = 0; run < 20; run++) {
+		heap.reset();
+		poolStats.measure([&]() {
+			replay(trace, blocks, [&](void* ptr, size_t osize, size_t nsize) {
+				return heap.realloc(ptr, osize, nsize);
+			});
+		});
+
+		// everything the script allocated was given back
+		ASSERT_EQ(0u, heap.used);
+		ASSERT_EQ(0u, heap.pool.getSlackBytes());
+	}
+	poolStats.report("Lua trace replay, size class pool");
+
+	printf("Lua pool: %d / %d bytes carved from %d chunks\n",
+		(int)heap.pool.getCarvedBytes(), (int)heap.pool.getSize(), (int)heap.pool.getChunkCount());
+	for (size_t i = 0; i < heap.pool.getClassCount(); i++) {
+		auto stats = heap.pool.getClassStats(i);
+		printf("  %d byte blocks: high water %d\n", (int)stats.blockSize, (int)stats.highWater);
+		EXPECT_EQ(0u, stats.inUse);
+	}
+}
@@ -0,0 +1,256 @@
+/*
+ * @file test_software_knock.cpp
+ *
+ * Block knock filter has to agree with per-sample Biquad::filter reference,
+ * multi-band mode has to pick up knock in the right band,
+ * sample buffer ring has to hand windows over in order and count the ones it cannot take
+ */
+
+#include "pch.h"
+
+#include "biquad.h"
+#include "goertzel.h"
+#include "software_knock.h"
+#include "benchmark_helper.h"
+
+#include <random>
+
+static constexpr float sampleRate = 217000;
+static constexpr float knockFrequency = 6500;
+static constexpr size_t windowSize = 2000;
+
+/**
+ * Sensor biased to vcc/2 with background noise and optionally a decaying knock ring
+ */
+static std::vector<uint16_t> makeWindow(float knockAmplitudeVolts, float noiseVolts, int seed, float frequency = knockFrequency) {
+	std::mt19937 rng(seed);
+	std::normal_distribution<float> noise(0, noiseVolts);
+
+	std::vector<uint16_t> samples(windowSize);
+	for (size_t i = 0; i < windowSize; i++) {
+		float t = i / sampleRate;
+		float knock = knockAmplitudeVolts * expf(-t * 2000) * sinf(2 * CONST_PI * frequency * t);
+		float volts = 1.65f + knock + noise(rng);
+		samples[i] = clampF(0, volts / 3.3f * 4095, 4095);
+	}
+	return samples;
+}
+
+/**
+ * Per-sample implementation as it was in processLastKnockEvent
+ */
+static float referenceDb(Biquad& filter, const std::vector<uint16_t>& samples) {
+	constexpr float ratio = 3.3f / 4095.0f;
+	filter.cookSteadyState(3.3f / 2);
+
+	float sumSq = 0;
+	for (uint16_t sample : samples) {
+		float filtered = filter.filter(ratio * sample);
+		sumSq += filtered * filtered;
+	}
+
+	return clampF(-100, 10 * log10(sumSq / samples.size()), 100);
+}
+
+TEST(SoftwareKnock, blockFilterMatchesReference) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	Biquad reference;
+	reference.configureBandpass(sampleRate, knockFrequency, 3);
+	Biquad block;
+	block.configureBandpass(sampleRate, knockFrequency, 3);
+
+	float quietDb = 0;
+	float knockDb = 0;
+
+	for (float amplitude : { 0.0f, 0.05f, 0.2f, 0.8f }) {
+		for (int seed = 0; seed < 5; seed++) {
+			auto samples = makeWindow(amplitude, 0.01f, seed);
+
+			float expected = referenceDb(reference, samples);
+			float actual = getKnockWindowDb(block, samples.data(), samples.size());
+			EXPECT_NEAR(expected, actual, 0.01) << "amplitude " << amplitude << " seed " << seed;
+
+			if (amplitude == 0) {
+				quietDb = actual;
+			} else {
+				knockDb = actual;
+			}
+		}
+	}
+
+	// sanity check of the synthetic signal: knock is well above noise floor
+	EXPECT_TRUE(knockDb > quietDb + 20);
+}
+
+TEST(SoftwareKnock, benchmarkWindow) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	auto samples = makeWindow(0.2f, 0.01f, 1);
+
+	Biquad reference;
+	reference.configureBandpass(sampleRate, knockFrequency, 3);
+	Biquad block;
+	block.configureBandpass(sampleRate, knockFrequency, 3);
+
+	float sum = 0;
+	runBenchmark("knock window 2000 samples, per sample", 2000, [&](int) {
+		sum += referenceDb(reference, samples);
+	});
+	runBenchmark("knock window 2000 samples, block", 2000, [&](int) {
+		sum += getKnockWindowDb(block, samples.data(), samples.size());
+	});
+
+	// keep the compiler from optimizing filtering away
+	EXPECT_TRUE(sum != 0);
+}
+
+TEST(SoftwareKnock, emptyWindow) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	Biquad filter;
+	filter.configureBandpass(sampleRate, knockFrequency, 3);
+
+	uint16_t sample = 0;
+	EXPECT_EQ(-100, getKnockWindowDb(filter, &sample, 0));
+}
+
+static const float spectrumBands[] = { 6500, 11000, 15500 };
+
+TEST(SoftwareKnock, spectrumPicksBand) {
+	GoertzelBank bank;
+	bank.configure(sampleRate, spectrumBands, efi::size(spectrumBands));
+	ASSERT_EQ(3u, bank.getBandCount());
+
+	for (size_t knockBand = 0; knockBand < efi::size(spectrumBands); knockBand++) {
+		auto quiet = makeWindow(0, 0.01f, 3);
+		auto knock = makeWindow(0.5f, 0.01f, 3, spectrumBands[knockBand]);
+
+		float quietDb[GOERTZEL_MAX_BANDS];
+		float knockDb[GOERTZEL_MAX_BANDS];
+		ASSERT_EQ(3u, getKnockWindowSpectrumDb(bank, quiet.data(), quiet.size(), quietDb));
+		ASSERT_EQ(3u, getKnockWindowSpectrumDb(bank, knock.data(), knock.size(), knockDb));
+
+		for (size_t band = 0; band < efi::size(spectrumBands); band++) {
+			if (band == knockBand) {
+				EXPECT_TRUE(knockDb[band] > quietDb[band] + 20) << "band " << band;
+			} else {
+				EXPECT_TRUE(knockDb[band] < knockDb[knockBand] - 10) << "band " << band << " knock at " << knockBand;
+			}
+		}
+	}
+}
+
+TEST(SoftwareKnock, spectrumSkipsUnsetBands) {
+	float bands[] = { 0, 7000, 0, 12000 };
+	GoertzelBank bank;
+	bank.configure(sampleRate, bands, efi::size(bands));
+	EXPECT_EQ(2u, bank.getBandCount());
+}
+
+/**
+ * Knock thread has to finish one window before the next cylinder fires:
+ * at 8000 rpm on 8 cylinders that is 720 / 8 degrees = 1.875ms
+ */
+TEST(SoftwareKnock, benchmarkSpectrum) {
+	auto samples = makeWindow(0.2f, 0.01f, 1);
+
+	float bands[GOERTZEL_MAX_BANDS] = { 6500, 9000, 11000, 15500 };
+	GoertzelBank bank;
+	bank.configure(sampleRate, bands, efi::size(bands));
+
+	float sum = 0;
+	auto result = runBenchmark("knock window 2000 samples, 4 band goertzel", 2000, [&](int) {
+		float bandDb[GOERTZEL_MAX_BANDS];
+		getKnockWindowSpectrumDb(bank, samples.data(), samples.size(), bandDb);
+		sum += bandDb[0];
+	});
+
+	constexpr float budgetNs = 1e9 * 60 / 8000 * 2 / 8;
+	printf("BENCHMARK knock budget at 8000rpm 8 cylinders: %.0fns, host p99 uses %.1f%%\n", budgetNs, 100 * result.p99Ns / budgetNs);
+
+	// keep the compiler from optimizing filtering away
+	EXPECT_TRUE(sum != 0);
+}
+
+static void startWindow(KnockSampleRing& ring, int index, uint8_t cylinderNumber) {
+	KnockSampleWindow& window = ring.getWindow(index);
+	window.cylinderNumber = cylinderNumber;
+	window.sampleCount = 100 + cylinderNumber;
+	ring.onStarted();
+}
+
+TEST(SoftwareKnock, sampleRingOrder) {
+	KnockSampleRing ring;
+	static_assert(KNOCK_SAMPLE_BUFFER_COUNT == 2);
+
+	// ADC fills one buffer after another while knock thread is busy
+	int first = ring.acquire();
+	ASSERT_EQ(0, first);
+	startWindow(ring, first, 3);
+	ring.onCompleted();
+
+	int second = ring.acquire();
+	ASSERT_EQ(1, second);
+	startWindow(ring, second, 5);
+	ring.onCompleted();
+
+	// every buffer is waiting for knock thread
+	EXPECT_EQ(-1, ring.acquire());
+
+	std::vector<uint8_t> cylinders;
+	EXPECT_EQ(2u, ring.drain([&](size_t index, const KnockSampleWindow& window) {
+		EXPECT_EQ(100u + window.cylinderNumber, window.sampleCount);
+		EXPECT_EQ(cylinders.size(), index);
+		cylinders.push_back(window.cylinderNumber);
+	}));
+	EXPECT_EQ((std::vector<uint8_t>{ 3, 5 }), cylinders);
+
+	// nothing left, buffers go around
+	EXPECT_EQ(0u, ring.drain([](size_t, const KnockSampleWindow&) { FAIL(); }));
+	EXPECT_EQ(0, ring.acquire());
+}
+
+TEST(SoftwareKnock, sampleRingReusesIncompleteWindow) {
+	KnockSampleRing ring;
+
+	int index = ring.acquire();
+	startWindow(ring, index, 1);
+
+	// ADC error: window never completed, knock thread gets nothing and the buffer is reused
+	EXPECT_EQ(0u, ring.drain([](size_t, const KnockSampleWindow&) { FAIL(); }));
+	EXPECT_EQ(index, ring.acquire());
+
+	startWindow(ring, index, 2);
+	ring.onCompleted();
+
+	uint8_t cylinder = 0;
+	EXPECT_EQ(1u, ring.drain([&](size_t, const KnockSampleWindow& window) {
+		cylinder = window.cylinderNumber;
+	}));
+	EXPECT_EQ(2, cylinder);
+}
+
+TEST(SoftwareKnock, droppedWindows) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	auto knock = engine->module<KnockController>();
+	KnockSampleRing ring;
+
+	// ADC still busy with previous window
+	EXPECT_EQ(-1, acquireKnockWindow(ring, false));
+	EXPECT_EQ(1u, knock->m_knockDroppedWindows);
+
+	for (size_t i = 0; i < KNOCK_SAMPLE_BUFFER_COUNT; i++) {
+		int index = acquireKnockWindow(ring, true);
+		ASSERT_EQ((int)i, index);
+		startWindow(ring, index, i);
+		ring.onCompleted();
+	}
+	EXPECT_EQ(1u, knock->m_knockDroppedWindows);
+
+	// knock thread fell behind, every buffer is waiting
+	EXPECT_EQ(-1, acquireKnockWindow(ring, true));
+	EXPECT_EQ(2u, knock->m_knockDroppedWindows);
+
+	ring.drain([](size_t, const KnockSampleWindow&) {});
+	EXPECT_EQ(0, acquireKnockWindow(ring, true));
+	EXPECT_EQ(2u, knock->m_knockDroppedWindows);
+}
@@ -0,0 +1,139 @@
+/*
+ * @file test_scheduling_heap.cpp
+ *
+ * EventQueue storage: pairing heap vs sorted list
+ */
+
+#include "pch.h"
+
+#include "scheduling_list.h"
+#include "scheduling_heap.h"
+#include "benchmark_helper.h"
+
+#include <random>
+
+template <typename TStorage>
+static void insertAt(TStorage& storage, scheduling_s& s, efitick_t time) {
+	s.momentX = time;
+	storage.insert(&s);
+}
+
+TEST(SchedulingHeap, simple) {
+	SchedulingHeap heap;
+	scheduling_s s1, s2, s3;
+
+	ASSERT_EQ(nullptr, heap.top());
+	ASSERT_EQ(nullptr, heap.pop());
+
+	insertAt(heap, s2, 20);
+	ASSERT_EQ(&s2, heap.top());
+	insertAt(heap, s3, 30);
+	ASSERT_EQ(&s2, heap.top());
+	insertAt(heap, s1, 10);
+	ASSERT_EQ(&s1, heap.top());
+	ASSERT_EQ(3, heap.size());
+
+	ASSERT_EQ(&s1, heap.getElementAtIndexForUnitText(0));
+	ASSERT_EQ(&s2, heap.getElementAtIndexForUnitText(1));
+	ASSERT_EQ(&s3, heap.getElementAtIndexForUnitText(2));
+	ASSERT_EQ(nullptr, heap.getElementAtIndexForUnitText(3));
+
+	ASSERT_EQ(&s1, heap.pop());
+	ASSERT_EQ(&s2, heap.pop());
+	ASSERT_EQ(&s3, heap.pop());
+	ASSERT_EQ(nullptr, heap.pop());
+	ASSERT_EQ(0, heap.size());
+}
+
+TEST(SchedulingHeap, removeNotPresent) {
+	SchedulingHeap heap;
+	scheduling_s s1, s2, s3;
+
+	insertAt(heap, s1, 10);
+	insertAt(heap, s2, 20);
+
+	EXPECT_FALSE(heap.remove(&s3));
+	EXPECT_EQ(2, heap.size());
+
+	EXPECT_TRUE(heap.remove(&s2));
+	EXPECT_FALSE(heap.remove(&s2));
+	EXPECT_TRUE(heap.remove(&s1));
+	EXPECT_EQ(nullptr, heap.top());
+}
+
+/**
+ * Random insert/remove/pop sequence, heap has to agree with the list on every timestamp it hands out
+ */
+TEST(SchedulingHeap, matchesList) {
+	static constexpr int count = 64;
+	scheduling_s listElements[count];
+	scheduling_s heapElements[count];
+	bool pending[count] = {};
+
+	SchedulingList list;
+	SchedulingHeap heap;
+
+	std::mt19937 rng(12345);
+
+	for (int step = 0; step < 5000; step++) {
+		int index = rng() % count;
+		int operation = rng() % 3;
+
+		if (operation == 0 && !pending[index]) {
+			efitick_t time = rng() % 1000;
+			insertAt(list, listElements[index], time);
+			insertAt(heap, heapElements[index], time);
+			pending[index] = true;
+		} else if (operation == 1 && pending[index]) {
+			ASSERT_TRUE(list.remove(&listElements[index]));
+			ASSERT_TRUE(heap.remove(&heapElements[index]));
+			pending[index] = false;
+		} else if (operation == 2 && list.top()) {
+			ASSERT_EQ(list.top()->momentX, heap.top()->momentX);
+			// equal timestamps may come out in different order, so pop by identity from the list
+			scheduling_s *fromHeap = heap.pop();
+			int popped = fromHeap - heapElements;
+			ASSERT_TRUE(list.remove(&listElements[popped]));
+			pending[popped] = false;
+		}
+
+		heap.assertIsSorted();
+		ASSERT_EQ(list.size(), heap.size());
+	}
+}
+
+template <typename TStorage>
+static void benchmarkStorage(const char *name, int pendingCount) {
+	std::vector<scheduling_s> pending(pendingCount);
+	TStorage storage;
+
+	// steady state: events spread over the next engine cycle
+	for (int i = 0; i < pendingCount; i++) {
+		insertAt(storage, pending[i], 100 * (i + 1));
+	}
+
+	scheduling_s probe;
+	char title[64];
+
+	// worst case for a sorted list: the new event goes to the very end
+	snprintf(title, sizeof(title), "%s insert pending=%d", name, pendingCount);
+	runBenchmark(title, 20000, [&](int) {
+		insertAt(storage, probe, 100 * (pendingCount + 1));
+		storage.remove(&probe);
+	});
+
+	snprintf(title, sizeof(title), "%s cancel+reschedule pending=%d", name, pendingCount);
+	runBenchmark(title, 20000, [&](int) {
+		storage.remove(&pending[pendingCount - 1]);
+		insertAt(storage, pending[pendingCount - 1], 100 * pendingCount);
+	});
+
+	ASSERT_EQ(pendingCount, storage.size());
+}
+
+TEST(SchedulingHeap, benchmark) {
+	for (int pendingCount : { 10, 50, 200 }) {
+		benchmarkStorage<SchedulingList>("list", pendingCount);
+		benchmarkStorage<SchedulingHeap>("heap", pendingCount);
+	}
+}
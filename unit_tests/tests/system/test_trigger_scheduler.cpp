@@ -0,0 +1,146 @@
+/*
+ * @file test_trigger_scheduler.cpp
+ *
+ * Tooth-based scheduling: every queued event has to be handed over to the time-based
+ * scheduler exactly once per engine cycle regardless of trigger shape.
+ */
+
+#include "pch.h"
+
+#include "benchmark_helper.h"
+
+static void noopAction(void *) {
+}
+
+static constexpr int eventCount = 48;
+
+static void queueEvents(AngleBasedEvent *events) {
+	for (int i = 0; i < eventCount; i++) {
+		// 12 cylinders with dwell, spark, trailing spark, aux - spread over the whole cycle
+		engine->module<TriggerScheduler>()->schedule("test", &events[i], i * 15 + 7.5f, noopAction);
+	}
+}
+
+static const trigger_type_e triggerTypes[] = {
+	trigger_type_e::TT_TOOTHED_WHEEL_60_2,
+	trigger_type_e::TT_TOOTHED_WHEEL_36_1,
+	trigger_type_e::TT_HONDA_K_CRANK_12_1,
+	trigger_type_e::TT_NISSAN_SR20VE,
+	trigger_type_e::TT_ONE_PLUS_ONE,
+};
+
+TEST(TriggerScheduler, eachEventOncePerCycle) {
+	for (trigger_type_e type : triggerTypes) {
+		// declared before engine so that queues never outlive the events
+		AngleBasedEvent events[eventCount];
+		EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+		eth.setTriggerType(type);
+		engine->rpmCalculator.setRpmValue(1000);
+
+		queueEvents(events);
+
+		auto windows = getToothWindowsForUnitTest();
+		ASSERT_TRUE(windows.size() > 0);
+
+		for (auto& window : windows) {
+			bool wasQueued[eventCount];
+			for (int i = 0; i < eventCount; i++) {
+				wasQueued[i] = events[i].phaseBucket >= 0;
+			}
+
+			engine->module<TriggerScheduler>()->scheduleEventsUntilNextTriggerTooth(1000, 0, window.first, window.second);
+
+			// exactly the events due before next tooth are handed over to the time-based scheduler
+			for (int i = 0; i < eventCount; i++) {
+				bool isDue = isPhaseInRange(events[i].enginePhase, window.first, window.second);
+				EXPECT_EQ(wasQueued[i] && !isDue, events[i].phaseBucket >= 0) << "event " << i;
+			}
+		}
+
+		EXPECT_EQ(eventCount, engine->executor.size()) << "trigger " << (int)type;
+		for (int i = 0; i < eventCount; i++) {
+			EXPECT_EQ(-1, events[i].phaseBucket) << "trigger " << (int)type << " event " << i;
+		}
+
+		eth.clearQueue();
+	}
+}
+
+TEST(TriggerScheduler, angleMovedWhileQueued) {
+	AngleBasedEvent event;
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	engine->rpmCalculator.setRpmValue(1000);
+	auto scheduler = engine->module<TriggerScheduler>();
+
+	scheduler->schedule("test", &event, 300, noopAction);
+	EXPECT_EQ(getPhaseBucket(300), event.phaseBucket);
+
+	// moved to an earlier angle: has to fire as soon as the crank gets there, not after it passes 300
+	scheduler->schedule("test", &event, 100, noopAction);
+	EXPECT_EQ(getPhaseBucket(100), event.phaseBucket);
+
+	scheduler->scheduleEventsUntilNextTriggerTooth(1000, 0, 90, 120);
+	EXPECT_EQ(-1, event.phaseBucket);
+	EXPECT_EQ(1, engine->executor.size());
+}
+
+TEST(TriggerScheduler, benchmarkPerTooth) {
+	for (trigger_type_e type : triggerTypes) {
+		AngleBasedEvent events[eventCount];
+		EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+		eth.setTriggerType(type);
+		engine->rpmCalculator.setRpmValue(8000);
+
+		auto windows = getToothWindowsForUnitTest();
+
+		BenchmarkStats stats;
+		for (int cycle = 0; cycle < 200; cycle++) {
+			queueEvents(events);
+
+			for (auto& window : windows) {
+				stats.measure([&]() {
+					engine->module<TriggerScheduler>()->scheduleEventsUntilNextTriggerTooth(8000, 0, window.first, window.second);
+				});
+			}
+
+			engine->executor.clear();
+		}
+
+		char title[64];
+		snprintf(title, sizeof(title), "TriggerScheduler trigger=%d teeth=%d", (int)type, (int)windows.size());
+		stats.report(title);
+	}
+}
+
+TEST(TriggerScheduler, toothAnchor) {
+	AngleBasedEvent beforeFirstTooth;
+	AngleBasedEvent inWindow;
+	AngleBasedEvent afterNextTooth;
+	AngleBasedEvent alreadyPassed;
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	engine->rpmCalculator.setRpmValue(1000);
+	auto scheduler = engine->module<TriggerScheduler>();
+
+	// no tooth yet, nothing to anchor to
+	EXPECT_FALSE(scheduler->scheduleOrQueue("test", &beforeFirstTooth, 300, noopAction));
+	EXPECT_TRUE(beforeFirstTooth.phaseBucket >= 0);
+
+	eth.setTimeAndInvokeEventsUs(1000);
+	scheduler->scheduleEventsUntilNextTriggerTooth(1000, getTimeNowNt(), 90, 120);
+
+	EXPECT_TRUE(scheduler->scheduleOrQueue("test", &inWindow, 100, noopAction));
+	EXPECT_EQ(-1, inWindow.phaseBucket);
+	ASSERT_EQ(1, engine->executor.size());
+	// 10 degrees after the tooth at 1000 rpm
+	EXPECT_NEAR(1000 + 1667, engine->executor.getForUnitTest(0)->momentX / US_TO_NT_MULTIPLIER, 1);
+
+	EXPECT_FALSE(scheduler->scheduleOrQueue("test", &afterNextTooth, 200, noopAction));
+	EXPECT_TRUE(afterNextTooth.phaseBucket >= 0);
+
+	// crank is past 95 degrees by now, queue would only get there next engine cycle so it fires right away
+	eth.setTimeAndInvokeEventsUs(1000 + 3000);
+	EXPECT_TRUE(scheduler->scheduleOrQueue("test", &alreadyPassed, 95, noopAction));
+	EXPECT_EQ(-1, alreadyPassed.phaseBucket);
+	ASSERT_EQ(1, engine->executor.size());
+	EXPECT_EQ(getTimeNowNt(), engine->executor.getForUnitTest(0)->momentX);
+}
@@ -1,4 +1,5 @@
 #include "log_field.h"
+#include "log_field_set.h"
 #include "buffered_writer.h"
 
 #include <gmock/gmock.h>
@@ -60,3 +61,61 @@ TEST(BinaryLogField, Value) {
 	// Check that big endian data was written, and bytes after weren't touched
 	EXPECT_THAT(buffer, ElementsAre(0x00, 0xbc, 0x61, 0x4e, 0xAA, 0xAA));
 }
+
+struct CaptureWriter : public Writer {
+	size_t write(const char* buffer, size_t count) override {
+		data.insert(data.end(), buffer, buffer + count);
+		return count;
+	}
+
+	size_t flush() override {
+		return 0;
+	}
+
+	std::vector<uint8_t> data;
+};
+
+TEST(BinaryLogField, MultiRate) {
+	uint16_t rpm = 0x1234;
+	float clt = 1.0f;
+	scaled_channel<int16_t, 10> map = 0;
+
+	const LogField testFields[] = {
+		{ clt, "clt", "C", 0 },
+		{ rpm, "rpm", "rpm", 0 },
+		{ map, "map", "kPa", 1 },
+	};
+
+	LogFieldSet<3> fieldSet(testFields);
+	fieldSet.setFast(rpm);
+	fieldSet.setFast(map);
+	EXPECT_EQ(4u, fieldSet.getFastRecordLength());
+	EXPECT_EQ(8u, fieldSet.getRecordLength());
+
+	// fast group comes first in the header
+	CaptureWriter headers;
+	fieldSet.writeHeaders(headers);
+	ASSERT_EQ(3u * 89, headers.data.size());
+	EXPECT_EQ('r', headers.data[1]);
+	EXPECT_EQ('m', headers.data[89 + 1]);
+	EXPECT_EQ('c', headers.data[2 * 89 + 1]);
+
+	CaptureWriter full;
+	fieldSet.writeBlock(full, true, 7, 0x0102);
+	EXPECT_THAT(full.data, ElementsAre(
+		MLQ_BLOCK_TYPE_DATA, 7, 0x01, 0x02,
+		0x12, 0x34,		// rpm
+		0, 0,			// map
+		0x3f, 0x80, 0, 0,	// clt
+		(0x12 + 0x34 + 0x3f + 0x80) & 0xFF));
+
+	// fast-only block: prefix length, then the fast fields only
+	CaptureWriter fast;
+	fieldSet.writeBlock(fast, false, 8, 0x0103);
+	EXPECT_THAT(fast.data, ElementsAre(
+		MLQ_BLOCK_TYPE_FAST_DATA, 8, 0x01, 0x03,
+		0, 4,			// fast record length
+		0x12, 0x34,
+		0, 0,
+		0x12 + 0x34));
+}
@@ -1,6 +1,8 @@
 #include "pch.h"
 
 #include "can_listener.h"
+#include "can_listener_dispatch.h"
+#include "benchmark_helper.h"
 
 using ::testing::StrictMock;
 using ::testing::_;
@@ -65,3 +67,128 @@ TEST(CanListener, FrameNotAcceptedChecksId) {
 
 	EXPECT_FALSE(dut.acceptFrame(frame));
 }
+
+struct CountingCanListener : public CanListener {
+	CountingCanListener(uint32_t id) : CanListener(id) { }
+
+	void decodeFrame(const CANRxFrame& frame, efitick_t nowNt) override {
+		decodeCount++;
+	}
+
+	int decodeCount = 0;
+};
+
+struct AnyIdCanListener : public CountingCanListener {
+	AnyIdCanListener() : CountingCanListener(0) { }
+
+	bool acceptFrame(const CANRxFrame& frame) const override {
+		return CAN_SID(frame) >= 0x300;
+	}
+
+	bool acceptsOnlyOwnId() const override {
+		return false;
+	}
+};
+
+static CANRxFrame makeFrame(uint32_t id) {
+	CANRxFrame frame = {};
+	frame.SID = id;
+	frame.IDE = false;
+	return frame;
+}
+
+TEST(CanListenerDispatch, OnlyMatchingListenersDecode) {
+	CountingCanListener a(0x100);
+	CountingCanListener b(0x200);
+	CountingCanListener c(0x200);
+	AnyIdCanListener any;
+
+	CanListenerDispatch dut;
+	dut.add(a);
+	dut.add(b);
+	dut.add(c);
+	dut.add(any);
+
+	dut.dispatch(makeFrame(0x200), 0);
+	EXPECT_EQ(0, a.decodeCount);
+	EXPECT_EQ(1, b.decodeCount);
+	EXPECT_EQ(1, c.decodeCount);
+	EXPECT_EQ(0, any.decodeCount);
+
+	// nobody has this ID exactly, custom acceptFrame still sees it
+	dut.dispatch(makeFrame(0x345), 0);
+	EXPECT_EQ(0, a.decodeCount);
+	EXPECT_EQ(1, b.decodeCount);
+	EXPECT_EQ(1, any.decodeCount);
+
+	dut.dispatch(makeFrame(0x100), 0);
+	EXPECT_EQ(1, a.decodeCount);
+	EXPECT_EQ(1, any.decodeCount);
+}
+
+TEST(CanListenerDispatch, SameResultAsListWalk) {
+	static constexpr int listenerCount = 50;
+	std::vector<std::unique_ptr<CountingCanListener>> listed;
+	std::vector<std::unique_ptr<CountingCanListener>> dispatched;
+
+	CanListener* head = nullptr;
+	CanListenerDispatch dut;
+
+	for (int i = 0; i < listenerCount; i++) {
+		// a few colliding IDs on purpose
+		uint32_t id = 0x400 + (i % 40) * 3;
+		listed.push_back(std::make_unique<CountingCanListener>(id));
+		listed.back()->setNext(head);
+		head = listed.back().get();
+
+		dispatched.push_back(std::make_unique<CountingCanListener>(id));
+		dut.add(*dispatched.back());
+	}
+
+	for (uint32_t id = 0x3F0; id < 0x500; id++) {
+		CANRxFrame frame = makeFrame(id);
+
+		for (CanListener* current = head; current; current = current->processFrame(frame, 0)) ;
+		dut.dispatch(frame, 0);
+	}
+
+	for (int i = 0; i < listenerCount; i++) {
+		EXPECT_EQ(1, dispatched[i]->decodeCount) << "listener " << i;
+		EXPECT_EQ(listed[i]->decodeCount, dispatched[i]->decodeCount) << "listener " << i;
+	}
+}
+
+TEST(CanListenerDispatch, benchmark50Listeners) {
+	static constexpr int listenerCount = 50;
+	std::vector<std::unique_ptr<CountingCanListener>> listeners;
+
+	CanListener* head = nullptr;
+	CanListenerDispatch dut;
+
+	for (int i = 0; i < listenerCount; i++) {
+		listeners.push_back(std::make_unique<CountingCanListener>(0x400 + i));
+		listeners.back()->setNext(head);
+		head = listeners.back().get();
+		dut.add(*listeners.back());
+	}
+
+	// half of the frames are for somebody else
+	std::vector<CANRxFrame> frames;
+	for (int i = 0; i < 2 * listenerCount; i++) {
+		frames.push_back(makeFrame(0x400 + i));
+	}
+
+	runBenchmark("CanListener list walk, 50 listeners", 20000, [&](int i) {
+		const CANRxFrame& frame = frames[i % frames.size()];
+		for (CanListener* current = head; current; current = current->processFrame(frame, 0)) ;
+	});
+
+	runBenchmark("CanListenerDispatch, 50 listeners", 20000, [&](int i) {
+		dut.dispatch(frames[i % frames.size()], 0);
+	});
+
+	// both paths decoded each addressed frame exactly once per pass
+	for (auto& listener : listeners) {
+		EXPECT_EQ(2 * 20000 / (int)frames.size(), listener->decodeCount);
+	}
+}
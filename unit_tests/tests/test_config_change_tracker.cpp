@@ -0,0 +1,67 @@
+/*
+ * @file test_config_change_tracker.cpp
+ */
+
+#include "pch.h"
+
+#include "config_change_tracker.h"
+#include "electronic_throttle.h"
+
+TEST(ConfigChangeTracker, onlyChangedRanges) {
+	static engine_configuration_s previous;
+	static engine_configuration_s current;
+	memset(&previous, 0, sizeof(previous));
+	memset(&current, 0, sizeof(current));
+
+	ConfigChangeTracker dut;
+	dut.update(previous, current);
+	EXPECT_FALSE(dut.isAnyChanged());
+	EXPECT_EQ(0u, dut.getChangedBlockCount());
+
+	current.gearRatio[3] = 1.5;
+	dut.update(previous, current);
+	EXPECT_TRUE(dut.isAnyChanged());
+	EXPECT_EQ(1u, dut.getChangedBlockCount());
+
+	EXPECT_TRUE(dut.isChanged(CONFIG_RANGE(gearRatio)));
+	EXPECT_TRUE(dut.isChanged(CONFIG_RANGE(gearRatio[3])));
+	// neighbours might share the CONFIG_CHANGE_BLOCK_SIZE block, these are far enough
+	EXPECT_FALSE(dut.isChanged(CONFIG_RANGE(gearRatio[0])));
+	EXPECT_FALSE(dut.isChanged(CONFIG_RANGE(gearRatio[7])));
+	EXPECT_FALSE(dut.isChanged(CONFIG_RANGE(etb)));
+	EXPECT_FALSE(dut.isChanged({ CONFIG_RANGE(etb), CONFIG_RANGE(trigger) }));
+	EXPECT_TRUE(dut.isChanged({ CONFIG_RANGE(etb), CONFIG_RANGE(gearRatio) }));
+
+	// nested fields
+	current.etb.pFactor = 3;
+	dut.update(previous, current);
+	EXPECT_TRUE(dut.isChanged(CONFIG_RANGE(etb)));
+	EXPECT_TRUE(dut.isChanged(CONFIG_RANGE(etb.pFactor)));
+	EXPECT_FALSE(dut.isChanged(CONFIG_RANGE(etb.iFactor)));
+
+	dut.setAllChanged();
+	EXPECT_TRUE(dut.isChanged(CONFIG_RANGE(trigger)));
+}
+
+TEST(ConfigChangeTracker, burn) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	engineConfiguration->totalGearsCount = 2;
+	engineConfiguration->gearRatio[0] = 3;
+	engineConfiguration->gearRatio[1] = 2;
+	incrementGlobalConfigurationVersion();
+	EXPECT_TRUE(getConfigChanges().isChanged(CONFIG_RANGE(gearRatio)));
+	EXPECT_TRUE(engine->module<GearDetector>().unmock().isConfigurationChangeRelevant(getConfigChanges()));
+
+	// fuel table lives outside of engine_configuration_s: nothing to re-initialize
+	config->veTable[0][0] = config->veTable[0][0] + 1;
+	incrementGlobalConfigurationVersion();
+	EXPECT_FALSE(getConfigChanges().isAnyChanged());
+	EXPECT_FALSE(engine->module<GearDetector>().unmock().isConfigurationChangeRelevant(getConfigChanges()));
+	EXPECT_FALSE(isElectronicThrottleConfigurationChanged(getConfigChanges()));
+
+	engineConfiguration->etb.pFactor++;
+	incrementGlobalConfigurationVersion();
+	EXPECT_TRUE(isElectronicThrottleConfigurationChanged(getConfigChanges()));
+	EXPECT_FALSE(engine->module<GearDetector>().unmock().isConfigurationChangeRelevant(getConfigChanges()));
+}
@@ -0,0 +1,327 @@
+/*
+ * @file test_flash_journal.cpp
+ *
+ * Journaled configuration storage on top of an emulated NOR flash which can lose power at any byte.
+ */
+
+#include "pch.h"
+
+#include "flash_journal.h"
+
+// not a multiple of FLASH_JOURNAL_UNIT on purpose
+#define TEST_IMAGE_SIZE 1000
+
+struct PowerSupply {
+	// bytes which can be written or erased before the power goes away
+	size_t budget = SIZE_MAX;
+	size_t used = 0;
+	bool isOn = true;
+
+	bool consume() {
+		if (!isOn || budget == 0) {
+			isOn = false;
+			return false;
+		}
+		budget--;
+		used++;
+		return true;
+	}
+
+	void powerOn() {
+		budget = SIZE_MAX;
+		used = 0;
+		isOn = true;
+	}
+};
+
+class FlashEmulator : public FlashJournalStorage {
+public:
+	FlashEmulator(PowerSupply& power, size_t size)
+		: m_power(power)
+		, m_data(size, 0xFF)
+		, m_isProgrammed(size / FLASH_JOURNAL_UNIT, false)
+	{
+	}
+
+	size_t getSize() override {
+		return m_data.size();
+	}
+
+	bool erase() override {
+		for (size_t i = 0; i < m_data.size(); i++) {
+			if (!m_power.consume()) {
+				// interrupted erase leaves whatever it leaves, the rest is untouched
+				return false;
+			}
+			m_data[i] = 0xFF;
+		}
+
+		std::fill(m_isProgrammed.begin(), m_isProgrammed.end(), false);
+		return true;
+	}
+
+	bool write(size_t offset, const uint8_t* buffer, size_t size) override {
+		EXPECT_EQ(0u, offset % FLASH_JOURNAL_UNIT) << "unaligned write at " << offset;
+
+		for (size_t unit = offset / FLASH_JOURNAL_UNIT; unit * FLASH_JOURNAL_UNIT < offset + size; unit++) {
+			EXPECT_FALSE(m_isProgrammed[unit]) << "unit written twice at " << unit * FLASH_JOURNAL_UNIT;
+			m_isProgrammed[unit] = true;
+		}
+
+		for (size_t i = 0; i < size; i++) {
+			if (!m_power.consume()) {
+				// the byte being programmed gets only some of its bits
+				m_data[offset + i] &= buffer[i] | 0xF0;
+				return false;
+			}
+			// NOR can only clear bits
+			m_data[offset + i] &= buffer[i];
+		}
+
+		return true;
+	}
+
+	void read(size_t offset, uint8_t* buffer, size_t size) override {
+		memcpy(buffer, m_data.data() + offset, size);
+	}
+
+	// after a power loss the emulator does not know which units were touched
+	void reboot() {
+		for (size_t unit = 0; unit < m_isProgrammed.size(); unit++) {
+			const uint8_t* data = m_data.data() + unit * FLASH_JOURNAL_UNIT;
+			m_isProgrammed[unit] = std::any_of(data, data + FLASH_JOURNAL_UNIT, [](uint8_t b) { return b != 0xFF; });
+		}
+	}
+
+private:
+	PowerSupply& m_power;
+	std::vector<uint8_t> m_data;
+	std::vector<bool> m_isProgrammed;
+};
+
+static std::vector<uint8_t> makeImage(int seed) {
+	std::vector<uint8_t> image(TEST_IMAGE_SIZE);
+	for (size_t i = 0; i < image.size(); i++) {
+		image[i] = (i * 7 + seed * 13) & 0xFF;
+	}
+	return image;
+}
+
+// a few tune edits in different places, including the very end of the image
+static std::vector<uint8_t> editImage(std::vector<uint8_t> image, int seed) {
+	image[10] += seed;
+	image[300 + seed] ^= 0x5A;
+	image[301 + seed] ^= 0x5A;
+	image[TEST_IMAGE_SIZE - 1] += 1;
+	return image;
+}
+
+static std::vector<uint8_t> readImage(FlashJournalStorage& storage) {
+	FlashJournal journal(storage, TEST_IMAGE_SIZE);
+	std::vector<uint8_t> image(TEST_IMAGE_SIZE);
+	journal.read(0, image.data(), image.size());
+	return image;
+}
+
+TEST(FlashJournal, appendOnlyChanges) {
+	PowerSupply power;
+	FlashEmulator flash(power, 4096);
+	FlashJournal journal(flash, TEST_IMAGE_SIZE);
+
+	auto image = makeImage(1);
+	EXPECT_EQ(FlashJournalResult::Compacted, journal.write(image.data()));
+	EXPECT_EQ(FlashJournalResult::Unchanged, journal.write(image.data()));
+
+	size_t freeSpace = journal.getFreeSpace();
+	power.used = 0;
+	image[500]++;
+	EXPECT_EQ(FlashJournalResult::Appended, journal.write(image.data()));
+	// header, one unit of data and the commit
+	EXPECT_EQ(freeSpace - 3 * FLASH_JOURNAL_UNIT, journal.getFreeSpace());
+	EXPECT_EQ(3u * FLASH_JOURNAL_UNIT, power.used);
+	EXPECT_EQ(1u, journal.getTransactionCount());
+
+	image = editImage(image, 2);
+	EXPECT_EQ(FlashJournalResult::Appended, journal.write(image.data()));
+	EXPECT_EQ(2u, journal.getTransactionCount());
+
+	// same thing after a reboot
+	EXPECT_EQ(image, readImage(flash));
+	FlashJournal rebooted(flash, TEST_IMAGE_SIZE);
+	EXPECT_EQ(2u, rebooted.getTransactionCount());
+	EXPECT_EQ(journal.getFreeSpace(), rebooted.getFreeSpace());
+}
+
+TEST(FlashJournal, compactWhenFull) {
+	PowerSupply power;
+	// room for a few small transactions only
+	FlashEmulator flash(power, 1536);
+	FlashJournal journal(flash, TEST_IMAGE_SIZE);
+
+	auto image = makeImage(1);
+	EXPECT_EQ(FlashJournalResult::Compacted, journal.write(image.data()));
+
+	int appendCount = 0;
+	FlashJournalResult result;
+	do {
+		image = editImage(image, appendCount);
+		result = journal.write(image.data());
+		EXPECT_EQ(image, readImage(flash));
+		if (result == FlashJournalResult::Appended) {
+			appendCount++;
+		}
+	} while (result == FlashJournalResult::Appended);
+
+	EXPECT_EQ(FlashJournalResult::Compacted, result);
+	EXPECT_TRUE(appendCount > 0);
+	EXPECT_EQ(0u, journal.getTransactionCount());
+}
+
+TEST(FlashJournal, compactAfterMaxTransactions) {
+	PowerSupply power;
+	FlashEmulator flash(power, 128 * 1024);
+	FlashJournal journal(flash, TEST_IMAGE_SIZE);
+
+	auto image = makeImage(1);
+	EXPECT_EQ(FlashJournalResult::Compacted, journal.write(image.data()));
+
+	for (int i = 0; i < FLASH_JOURNAL_MAX_TRANSACTIONS; i++) {
+		image[i]++;
+		ASSERT_EQ(FlashJournalResult::Appended, journal.write(image.data()));
+	}
+
+	image[0]++;
+	EXPECT_EQ(FlashJournalResult::Compacted, journal.write(image.data()));
+	EXPECT_EQ(image, readImage(flash));
+}
+
+TEST(FlashJournal, largeChangeDoesNotFit) {
+	PowerSupply power;
+	FlashEmulator flash(power, 1536);
+	FlashJournal journal(flash, TEST_IMAGE_SIZE);
+
+	auto image = makeImage(1);
+	journal.write(image.data());
+
+	// whole different tune: no room for the records, the half written transaction is ignored
+	auto other = makeImage(2);
+	EXPECT_EQ(FlashJournalResult::Compacted, journal.write(other.data()));
+	EXPECT_EQ(other, readImage(flash));
+}
+
+TEST(FlashJournal, powerLossDuringAppend) {
+	const size_t regionSize = 8192;
+	auto oldImage = editImage(makeImage(1), 3);
+	auto newImage = editImage(oldImage, 4);
+	// and one more region which needs a record of its own
+	newImage[700] ^= 0xFF;
+
+	// how many bytes the burn takes
+	size_t burnSize;
+	{
+		PowerSupply power;
+		FlashEmulator flash(power, regionSize);
+		FlashJournal journal(flash, TEST_IMAGE_SIZE);
+		journal.write(makeImage(1).data());
+		journal.write(oldImage.data());
+		power.used = 0;
+		ASSERT_EQ(FlashJournalResult::Appended, journal.write(newImage.data()));
+		burnSize = power.used;
+	}
+
+	for (size_t budget = 0; budget <= burnSize; budget++) {
+		PowerSupply power;
+		FlashEmulator flash(power, regionSize);
+		{
+			FlashJournal journal(flash, TEST_IMAGE_SIZE);
+			journal.write(makeImage(1).data());
+			journal.write(oldImage.data());
+			power.budget = budget;
+			journal.write(newImage.data());
+		}
+
+		power.powerOn();
+		flash.reboot();
+
+		auto recovered = readImage(flash);
+		if (budget < burnSize) {
+			// the commit is the very last thing written
+			EXPECT_EQ(oldImage, recovered) << "budget " << budget;
+		} else {
+			EXPECT_EQ(newImage, recovered) << "budget " << budget;
+		}
+
+		// and the next burn still works
+		FlashJournal journal(flash, TEST_IMAGE_SIZE);
+		auto nextImage = editImage(newImage, 5);
+		EXPECT_NE(FlashJournalResult::Failed, journal.write(nextImage.data()));
+		EXPECT_EQ(nextImage, readImage(flash)) << "budget " << budget;
+	}
+}
+
+// what flash_main does with the two copies: image carries its own crc, second copy is the fallback
+static std::vector<uint8_t> sealImage(std::vector<uint8_t> image) {
+	uint32_t crc = crc32(image.data(), image.size() - 4);
+	memcpy(image.data() + image.size() - 4, &crc, 4);
+	return image;
+}
+
+static bool isSealed(const std::vector<uint8_t>& image) {
+	uint32_t crc;
+	memcpy(&crc, image.data() + image.size() - 4, 4);
+	return crc == crc32((void*)image.data(), image.size() - 4);
+}
+
+static void burnBothCopies(FlashJournalStorage& first, FlashJournalStorage& second, const std::vector<uint8_t>& image) {
+	FlashJournal firstJournal(first, TEST_IMAGE_SIZE);
+	if (firstJournal.write(image.data()) == FlashJournalResult::Failed) {
+		return;
+	}
+	FlashJournal secondJournal(second, TEST_IMAGE_SIZE);
+	secondJournal.write(image.data());
+}
+
+static std::vector<uint8_t> bootFromCopies(FlashJournalStorage& first, FlashJournalStorage& second) {
+	auto image = readImage(first);
+	if (isSealed(image)) {
+		return image;
+	}
+	return readImage(second);
+}
+
+TEST(FlashJournal, powerLossDuringCompaction) {
+	// too small for anything but the base image: every burn compacts
+	const size_t regionSize = 1024 + FLASH_JOURNAL_UNIT;
+	auto oldImage = sealImage(makeImage(1));
+	auto newImage = sealImage(makeImage(2));
+
+	size_t burnSize;
+	{
+		PowerSupply power;
+		FlashEmulator first(power, regionSize);
+		FlashEmulator second(power, regionSize);
+		burnBothCopies(first, second, oldImage);
+		power.used = 0;
+		burnBothCopies(first, second, newImage);
+		burnSize = power.used;
+	}
+
+	for (size_t budget = 0; budget <= burnSize; budget++) {
+		PowerSupply power;
+		FlashEmulator first(power, regionSize);
+		FlashEmulator second(power, regionSize);
+		burnBothCopies(first, second, oldImage);
+		power.budget = budget;
+		burnBothCopies(first, second, newImage);
+
+		power.powerOn();
+		first.reboot();
+		second.reboot();
+
+		auto recovered = bootFromCopies(first, second);
+		EXPECT_TRUE(recovered == oldImage || recovered == newImage) << "budget " << budget;
+		if (budget == burnSize) {
+			EXPECT_EQ(newImage, recovered);
+		}
+	}
+}
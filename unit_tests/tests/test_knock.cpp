@@ -84,3 +84,38 @@ TEST(Knock, Reapply) {
 	// Should have no knock retard
 	EXPECT_FLOAT_EQ(dut.getKnockRetard(), 0);
 }
+
+TEST(Knock, MultiBand) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	// Aggression of 10%
+	engineConfiguration->knockRetardAggression = 10;
+
+	MockKnockController dut;
+	dut.onFastCallback();
+
+	// All bands quiet
+	float quiet[] = { 10, 12, 5 };
+	EXPECT_FALSE(dut.onKnockSenseCompleted(3, quiet, efi::size(quiet), 0));
+	EXPECT_FLOAT_EQ(dut.getKnockRetard(), 0);
+	EXPECT_FLOAT_EQ(dut.getKnockBandLevel(3, 1), 12);
+
+	// One loud band is enough
+	float loud[] = { 10, 12, 30 };
+	EXPECT_TRUE(dut.onKnockSenseCompleted(3, loud, efi::size(loud), 0));
+	EXPECT_FLOAT_EQ(dut.getKnockRetard(), 2);
+	EXPECT_FLOAT_EQ(dut.getKnockBandLevel(3, 2), 30);
+
+	// Other cylinders untouched
+	EXPECT_FLOAT_EQ(dut.getKnockBandLevel(2, 2), 0);
+
+	// Band peaks are published as live data
+	EXPECT_EQ(dut.m_knockBand[1], 12);
+	EXPECT_EQ(dut.m_knockBand[2], 30);
+
+	// Out of range cylinder is ignored
+	EXPECT_FALSE(dut.onKnockSenseCompleted(12, loud, efi::size(loud), 0));
+	EXPECT_FALSE(dut.onKnockSenseCompleted(200, 50, 0));
+	EXPECT_EQ(dut.getKnockCount(), 1);
+	EXPECT_FLOAT_EQ(dut.getKnockRetard(), 2);
+}
@@ -0,0 +1,103 @@
+/*
+ * @file test_map_averaging.cpp
+ *
+ * MAP averaging start and end scheduling, see mapAveragingTriggerCallback
+ */
+
+#include "pch.h"
+#include "map_averaging.h"
+#include "linear_func.h"
+
+using ::testing::_;
+using ::testing::SaveArg;
+using ::testing::StrictMock;
+
+// 1 volt is 100 kPa
+static LinearFunc mapFunc;
+
+static void setupMapAveraging(int rpm) {
+	engine->rpmCalculator.setRpmValue(rpm);
+
+	engineConfiguration->measureMapOnlyInOneCylinder = true;
+	engineConfiguration->mapMinBufferLength = 1;
+	setArrayValues(engineConfiguration->map.samplingAngle, 100);
+	setArrayValues(engineConfiguration->map.samplingWindow, 10);
+	refreshMapAveragingPreCalc();
+	initMapAveraging();
+	ASSERT_EQ(100, engine->engineState.mapAveragingStart[0]);
+
+	mapFunc.configure(0, 0, 5, 500, 0, 1000);
+	getMapAvg(0).setFunction(mapFunc);
+}
+
+TEST(MapAveraging, startEnd) {
+	StrictMock<MockExecutor> mockExec;
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	setupMapAveraging(1000);
+	engine->executor.setMockExecutor(&mockExec);
+
+	eth.setTimeAndInvokeEventsUs(1000);
+	efitick_t toothNt = getTimeNowNt();
+	float oneDegreeUs = engine->rpmCalculator.oneDegreeUs;
+
+	action_s startAction;
+	action_s endAction;
+	// start at 100 is 10 degrees after the tooth at 90
+	EXPECT_CALL(mockExec, scheduleByTimestampNt(_, _, toothNt + USF2NT(oneDegreeUs * 10), _))
+		.WillOnce(SaveArg<3>(&startAction));
+	// end at 110 is within the same tooth window, anchored to the same tooth
+	EXPECT_CALL(mockExec, scheduleByTimestampNt(_, _, toothNt + USF2NT(oneDegreeUs * 20), _))
+		.WillOnce(SaveArg<3>(&endAction));
+
+	engine->module<TriggerScheduler>()->scheduleEventsUntilNextTriggerTooth(1000, toothNt, 90, 120);
+	scheduleMapAveraging(toothNt, 90, 120);
+
+	// mock executor does not run anything, we do
+	eth.setTimeAndInvokeEventsUs(1000 + 1667);
+	ASSERT_TRUE(startAction);
+	startAction.execute();
+
+	getMapAvg(0).submit(1);
+	getMapAvg(0).submit(3);
+
+	ASSERT_TRUE(endAction);
+	endAction.execute();
+
+	EXPECT_NEAR(200, getMapAvg(0).get().value_or(0), EPS4D);
+	getMapAvg(0).invalidate();
+}
+
+TEST(MapAveraging, endAlreadyPassed) {
+	StrictMock<MockExecutor> mockExec;
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	setupMapAveraging(500);
+	engine->executor.setMockExecutor(&mockExec);
+
+	eth.setTimeAndInvokeEventsUs(1000);
+	efitick_t toothNt = getTimeNowNt();
+
+	action_s startAction;
+	EXPECT_CALL(mockExec, scheduleByTimestampNt(_, _, toothNt + USF2NT(engine->rpmCalculator.oneDegreeUs * 10), _))
+		.WillOnce(SaveArg<3>(&startAction));
+
+	engine->module<TriggerScheduler>()->scheduleEventsUntilNextTriggerTooth(500, toothNt, 90, 120);
+	scheduleMapAveraging(toothNt, 90, 120);
+
+	// engine speeds up within the tooth window: by the time averaging starts end angle is behind the crank
+	engine->rpmCalculator.oneDegreeUs = getOneDegreeTimeUs(2000);
+	eth.setTimeAndInvokeEventsUs(1000 + 3333);
+
+	action_s endAction;
+	// not a whole engine cycle later
+	EXPECT_CALL(mockExec, scheduleByTimestampNt(_, _, getTimeNowNt(), _))
+		.WillOnce(SaveArg<3>(&endAction));
+	ASSERT_TRUE(startAction);
+	startAction.execute();
+
+	getMapAvg(0).submit(1);
+	ASSERT_TRUE(endAction);
+	endAction.execute();
+
+	EXPECT_NEAR(100, getMapAvg(0).get().value_or(0), EPS4D);
+	getMapAvg(0).invalidate();
+}
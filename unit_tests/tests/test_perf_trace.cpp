@@ -0,0 +1,92 @@
+/*
+ * @file test_perf_trace.cpp
+ *
+ * Host side perf trace: ScopePerf instrumentation recorded with wall clock and saved as Chrome trace JSON
+ */
+
+#include "pch.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+static std::string readFile(const char* fileName) {
+	std::ifstream in(fileName);
+	std::stringstream ss;
+	ss << in.rdbuf();
+	return ss.str();
+}
+
+static int countOccurrences(const std::string& text, const std::string& what) {
+	int result = 0;
+	for (size_t pos = text.find(what); pos != std::string::npos; pos = text.find(what, pos + 1)) {
+		result++;
+	}
+	return result;
+}
+
+namespace {
+// keeps a whole run capture (RUSEFI_PERF_TRACE) intact and cleans up the files written by the test
+class PerfTrace : public ::testing::Test {
+protected:
+	void SetUp() override {
+		perfTraceHostSave();
+	}
+
+	void TearDown() override {
+		perfTraceHostRestore();
+		for (auto fileName : m_fileNames) {
+			remove(fileName);
+		}
+	}
+
+	const char* jsonFile(const char* fileName) {
+		m_fileNames.push_back(fileName);
+		return fileName;
+	}
+
+private:
+	std::vector<const char*> m_fileNames;
+};
+}
+
+TEST_F(PerfTrace, hostJson) {
+	perfTraceHostStart();
+	{
+		ScopePerf outer(PE::Temporary1);
+		ScopePerf inner(PE::Temporary2);
+		perfEventInstantGlobal(PE::Temporary3);
+	}
+	const char* fileName = jsonFile("perf_trace_test.json");
+	ASSERT_EQ(5, perfTraceHostWriteJson(fileName));
+
+	// not recording any more
+	{
+		ScopePerf perf(PE::Temporary4);
+	}
+
+	std::string json = readFile(fileName);
+	EXPECT_EQ(0u, json.find("{\"traceEvents\": ["));
+	EXPECT_EQ(1, countOccurrences(json, "{\"name\":\"Temporary1\",\"ph\":\"B\","));
+	EXPECT_EQ(1, countOccurrences(json, "{\"name\":\"Temporary1\",\"ph\":\"E\","));
+	EXPECT_EQ(1, countOccurrences(json, "{\"name\":\"Temporary3\",\"ph\":\"i\",\"s\":\"g\","));
+	EXPECT_EQ(0, countOccurrences(json, "Temporary4"));
+
+	// inner scope closes before the outer one
+	EXPECT_TRUE(json.find("{\"name\":\"Temporary2\",\"ph\":\"E\"") < json.find("{\"name\":\"Temporary1\",\"ph\":\"E\""));
+}
+
+TEST_F(PerfTrace, triggerPath) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	setupSimpleTestEngineWithMafAndTT_ONE_trigger(&eth);
+
+	perfTraceHostStart();
+	eth.fireTriggerEvents2(/* count */ 20, /* delayMs */ 40);
+	const char* fileName = jsonFile("perf_trace_trigger.json");
+	ASSERT_TRUE(perfTraceHostWriteJson(fileName) > 0);
+
+	std::string json = readFile(fileName);
+	int begin = countOccurrences(json, "{\"name\":\"DecodeTriggerEvent\",\"ph\":\"B\",");
+	EXPECT_TRUE(begin >= 20);
+	EXPECT_EQ(begin, countOccurrences(json, "{\"name\":\"DecodeTriggerEvent\",\"ph\":\"E\","));
+}
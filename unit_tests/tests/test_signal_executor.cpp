@@ -97,9 +97,9 @@ TEST(EventQueue, complex) {
 
 	ASSERT_EQ(4, eq.size());
 	ASSERT_EQ(10, eq.getHead()->momentX);
-	ASSERT_EQ(10, eq.getHead()->nextScheduling_s->momentX);
-	ASSERT_EQ(11, eq.getHead()->nextScheduling_s->nextScheduling_s->momentX);
-	ASSERT_EQ(12, eq.getHead()->nextScheduling_s->nextScheduling_s->nextScheduling_s->momentX);
+	ASSERT_EQ(10, eq.getElementAtIndexForUnitText(1)->momentX);
+	ASSERT_EQ(11, eq.getElementAtIndexForUnitText(2)->momentX);
+	ASSERT_EQ(12, eq.getElementAtIndexForUnitText(3)->momentX);
 
 	callbackCounter = 0;
 	eq.executeAll(10);
@@ -0,0 +1,165 @@
+/*
+ * @file test_tooth_log_compact.cpp
+ *
+ * Compact tooth log: firmware encoder against the host side decoder.
+ */
+
+#include "pch.h"
+
+#include "tooth_log_compact.h"
+#include "tooth_log_decoder.h"
+
+struct CaptureWriter : public Writer {
+	size_t write(const char* buffer, size_t count) override {
+		data.insert(data.end(), buffer, buffer + count);
+		return count;
+	}
+
+	size_t flush() override {
+		return 0;
+	}
+
+	std::vector<uint8_t> data;
+};
+
+static composite_logger_s makeEntry(uint32_t timestampUs, uint8_t flags) {
+	composite_logger_s entry = {};
+	// same byte order as the tooth logger
+	entry.timestamp = SWAP_UINT32(timestampUs);
+	setToothLogFlags(entry, flags);
+	return entry;
+}
+
+static void expectSameEntries(const std::vector<composite_logger_s>& expected, const std::vector<composite_logger_s>& actual) {
+	ASSERT_EQ(expected.size(), actual.size());
+	for (size_t i = 0; i < expected.size(); i++) {
+		EXPECT_EQ(expected[i].timestamp, actual[i].timestamp) << "entry " << i;
+		EXPECT_EQ(getToothLogFlags(expected[i]), getToothLogFlags(actual[i])) << "entry " << i;
+	}
+}
+
+static std::vector<composite_logger_s> roundTrip(const std::vector<composite_logger_s>& entries, size_t* encodedSize = nullptr) {
+	CaptureWriter writer;
+	writeToothLogCompact(writer, entries.data(), entries.size());
+	if (encodedSize) {
+		*encodedSize = writer.data.size();
+	}
+
+	std::vector<composite_logger_s> result;
+	EXPECT_TRUE(decodeToothLogCompact(writer.data.data(), writer.data.size(), result));
+	return result;
+}
+
+// both edges of 60-2 at 7000 rpm, with TDC marks
+static std::vector<composite_logger_s> makeRunningEngine(size_t count) {
+	std::vector<composite_logger_s> entries;
+
+	uint32_t timestamp = 1000000;
+	// 60 teeth per 8.57ms revolution, half of that per edge
+	const uint32_t edgeUs = 71;
+	bool level = false;
+	int tooth = 0;
+
+	while (entries.size() < count) {
+		bool isGap = tooth >= 58;
+		timestamp += isGap ? 3 * edgeUs : edgeUs + (tooth % 3);
+
+		level = !level;
+		uint8_t sync = entries.size() > 200 ? 1 << 3 : 0;
+		entries.push_back(makeEntry(timestamp, level | sync));
+
+		if (level && tooth == 20) {
+			// TDC mark on, then off
+			entries.push_back(makeEntry(timestamp, level | sync | 1 << 2));
+			entries.push_back(makeEntry(timestamp, level | sync));
+		}
+
+		if (!level) {
+			tooth = isGap ? 0 : tooth + 1;
+		}
+	}
+
+	entries.resize(count);
+	return entries;
+}
+
+TEST(ToothLogCompact, runningEngine) {
+	auto entries = makeRunningEngine(toothLoggerEntriesPerBuffer);
+
+	size_t encodedSize;
+	auto decoded = roundTrip(entries, &encodedSize);
+	expectSameEntries(entries, decoded);
+
+	size_t rawSize = entries.size() * sizeof(composite_logger_s);
+	printf("Tooth log: %d bytes raw, %d bytes compact\n", (int)rawSize, (int)encodedSize);
+	// deltas fit into two bytes and edges alternate in one long run
+	EXPECT_TRUE(encodedSize * 2 < rawSize);
+	EXPECT_TRUE(encodedSize <= getToothLogCompactMaxSize(entries.size()));
+}
+
+TEST(ToothLogCompact, concatenatedChunks) {
+	auto entries = makeRunningEngine(3 * toothLoggerEntriesPerBuffer);
+
+	// same as the SD card file: one chunk per logger buffer
+	CaptureWriter writer;
+	for (size_t i = 0; i < entries.size(); i += toothLoggerEntriesPerBuffer) {
+		writeToothLogCompact(writer, &entries[i], toothLoggerEntriesPerBuffer);
+	}
+
+	std::vector<composite_logger_s> decoded;
+	ASSERT_TRUE(decodeToothLogCompact(writer.data.data(), writer.data.size(), decoded));
+	expectSameEntries(entries, decoded);
+}
+
+TEST(ToothLogCompact, outOfOrderAndWrapAround) {
+	std::vector<composite_logger_s> entries = {
+		makeEntry(0xFFFFFF00, 0x01),
+		// from another interrupt, a bit earlier
+		makeEntry(0xFFFFFEF0, 0x03),
+		// 32 bit microsecond counter wraps around
+		makeEntry(0x00000010, 0x02),
+		// cranking: a very long tooth
+		makeEntry(0x00F00010, 0x3F),
+		makeEntry(0x00F00010, 0x00),
+	};
+
+	expectSameEntries(entries, roundTrip(entries));
+}
+
+TEST(ToothLogCompact, worstCaseSize) {
+	std::vector<composite_logger_s> entries;
+	uint32_t timestamp = 0;
+	for (size_t i = 0; i < toothLoggerEntriesPerBuffer; i++) {
+		// every entry flips a different set of flags and jumps far ahead
+		timestamp += 0x7FFFFFFF;
+		entries.push_back(makeEntry(timestamp, (i * 7) & 0x3F));
+	}
+
+	size_t encodedSize;
+	expectSameEntries(entries, roundTrip(entries, &encodedSize));
+	EXPECT_TRUE(encodedSize <= getToothLogCompactMaxSize(entries.size()));
+
+	ToothLogCompactBuffer buffer;
+	writeToothLogCompact(buffer, entries.data(), entries.size());
+	EXPECT_EQ(encodedSize, buffer.size);
+}
+
+TEST(ToothLogCompact, empty) {
+	CaptureWriter writer;
+	writeToothLogCompact(writer, nullptr, 0);
+	EXPECT_EQ(0u, writer.data.size());
+}
+
+TEST(ToothLogCompact, malformed) {
+	auto entries = makeRunningEngine(20);
+	CaptureWriter writer;
+	writeToothLogCompact(writer, entries.data(), entries.size());
+
+	std::vector<composite_logger_s> decoded;
+	// cut in the middle of a run
+	EXPECT_FALSE(decodeToothLogCompact(writer.data.data(), writer.data.size() - 3, decoded));
+
+	// no chunk header
+	decoded.clear();
+	EXPECT_FALSE(decodeToothLogCompact(writer.data.data() + 5, writer.data.size() - 5, decoded));
+}
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "tunerstudio.h"
 #include "tunerstudio_io.h"
+#include "rusefi_lua.h"
 
 static uint8_t st5TestBuffer[16000];
 
@@ -84,3 +85,76 @@ TEST(TunerstudioCommands, writeChunkEngineConfig) {
 
 	EXPECT_EQ(configBytes[100], 50);
 }
+
+static uint32_t getTsCrc(TunerStudio& instance, uint16_t offset, uint16_t count) {
+	BufferTsChannel channel;
+	instance.handleCrc32Check(&channel, TS_CRC, offset, count);
+
+	// size, response code, then big endian crc32
+	EXPECT_EQ(channel.writeIdx, 2 + 1 + 4 + 4u);
+	return st5TestBuffer[3] << 24 | st5TestBuffer[4] << 16 | st5TestBuffer[5] << 8 | st5TestBuffer[6];
+}
+
+TEST(TunerstudioCommands, crc32CheckCachedBlocks) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	::testing::NiceMock<MockTsChannel> channel;
+	TunerStudio instance;
+
+	uint8_t* configBytes = reinterpret_cast<uint8_t*>(config);
+	size_t blockCount = TOTAL_CONFIG_SIZE / TS_CRC_BLOCK_SIZE;
+
+	EXPECT_EQ(crc32(configBytes, TOTAL_CONFIG_SIZE), getTsCrc(instance, 0, TOTAL_CONFIG_SIZE));
+	EXPECT_EQ(blockCount, instance.getPageCrcBlockComputeCounter());
+
+	// nothing changed, nothing recomputed
+	EXPECT_EQ(crc32(configBytes, TOTAL_CONFIG_SIZE), getTsCrc(instance, 0, TOTAL_CONFIG_SIZE));
+	EXPECT_EQ(blockCount, instance.getPageCrcBlockComputeCounter());
+
+	// chunk across a block boundary
+	uint8_t values[10];
+	for (size_t i = 0; i < efi::size(values); i++) {
+		values[i] = configBytes[TS_CRC_BLOCK_SIZE - 5 + i] + 1;
+	}
+	instance.handleWriteChunkCommand(&channel, TS_CRC, TS_CRC_BLOCK_SIZE - 5, sizeof(values), values);
+	EXPECT_EQ(crc32(configBytes, TOTAL_CONFIG_SIZE), getTsCrc(instance, 0, TOTAL_CONFIG_SIZE));
+	EXPECT_EQ(blockCount + 2, instance.getPageCrcBlockComputeCounter());
+
+	instance.handleWriteValueCommand(&channel, TS_CRC, 5000, (uint8_t)(configBytes[5000] + 1));
+	EXPECT_EQ(crc32(configBytes, TOTAL_CONFIG_SIZE), getTsCrc(instance, 0, TOTAL_CONFIG_SIZE));
+	EXPECT_EQ(blockCount + 3, instance.getPageCrcBlockComputeCounter());
+
+	// ranges which do not start or end on a block boundary
+	EXPECT_EQ(crc32(configBytes + 100, 1000), getTsCrc(instance, 100, 1000));
+	EXPECT_EQ(crc32(configBytes + 300, 10), getTsCrc(instance, 300, 10));
+	EXPECT_EQ(crc32(configBytes + 4000, TOTAL_CONFIG_SIZE - 4000), getTsCrc(instance, 4000, TOTAL_CONFIG_SIZE - 4000));
+
+	// change outside of TS
+	configBytes[3000]++;
+	incrementGlobalConfigurationVersion();
+	EXPECT_EQ(crc32(configBytes, TOTAL_CONFIG_SIZE), getTsCrc(instance, 0, TOTAL_CONFIG_SIZE));
+
+	// change outside of TS which does not bump the version
+	configBytes[6000]++;
+	invalidateTsPageCrc();
+	EXPECT_EQ(crc32(configBytes, TOTAL_CONFIG_SIZE), getTsCrc(instance, 0, TOTAL_CONFIG_SIZE));
+
+	// same for Lua calibration without version bump
+	testLuaExecString("setCalibration(\"cranking.rpm\", 555, false)");
+	EXPECT_EQ(555, engineConfiguration->cranking.rpm);
+	EXPECT_EQ(crc32(configBytes, TOTAL_CONFIG_SIZE), getTsCrc(instance, 0, TOTAL_CONFIG_SIZE));
+}
+
+TEST(TunerstudioCommands, crc32CombineBlock) {
+	uint8_t data[3 * TS_CRC_BLOCK_SIZE];
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = i * 7 + 3;
+	}
+
+	uint32_t crc = crc32(data, 17);
+	crc = crc32CombineBlock(crc, crc32(data + 17, TS_CRC_BLOCK_SIZE));
+	crc = crc32CombineBlock(crc, crc32(data + 17 + TS_CRC_BLOCK_SIZE, TS_CRC_BLOCK_SIZE));
+	EXPECT_EQ(crc32(data, 17 + 2 * TS_CRC_BLOCK_SIZE), crc);
+
+	// empty prefix
+	EXPECT_EQ(crc32(data, TS_CRC_BLOCK_SIZE), crc32CombineBlock(0, crc32(data, TS_CRC_BLOCK_SIZE)));
+}
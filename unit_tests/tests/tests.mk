@@ -26,15 +26,18 @@ TESTS_SRC_CPP = \
 	tests/trigger/test_map_cam.cpp \
 	tests/trigger/test_rpm_multiplier.cpp \
 	tests/trigger/test_rpm_acceleration.cpp \
+	tests/trigger/test_angle_prediction.cpp \
 	tests/trigger/test_quad_cam.cpp \
 	tests/trigger/test_nissan_vq_vvt.cpp \
 	tests/trigger/test_override_gaps.cpp \
 	tests/trigger/test_injection_scheduling.cpp \
+	tests/trigger/test_trigger_replay_benchmark.cpp \
 	tests/sent/test_sent.cpp \
 	tests/ignition_injection/injection_mode_transition.cpp \
 	tests/ignition_injection/test_startOfCrankingPrimingPulse.cpp \
 	tests/ignition_injection/test_multispark.cpp \
 	tests/ignition_injection/test_ignition_scheduling.cpp \
+	tests/ignition_injection/test_phase_dispatch.cpp \
 	tests/ignition_injection/test_fuelCut.cpp \
 	tests/ignition_injection/test_fuel_computer.cpp \
 	tests/ignition_injection/test_injector_model.cpp \
@@ -54,10 +57,18 @@ TESTS_SRC_CPP = \
 	tests/lua/test_lua_Leiderman_Khlystov.cpp \
 	tests/lua/test_can_filter.cpp \
 	tests/lua/test_lua_vin.cpp \
+	tests/lua/test_lua_benchmark.cpp \
+	tests/lua/test_lua_small_object_pool.cpp \
+	tests/lua/test_lua_bytecode_cache.cpp \
 	tests/test_change_engine_type.cpp \
+	tests/test_perf_trace.cpp \
+	tests/test_map_averaging.cpp \
 	tests/util/test_scaled_channel.cpp \
 	tests/util/test_timer.cpp \
+	tests/util/test_map3d_lookup.cpp \
 	tests/system/test_periodic_thread_controller.cpp \
+	tests/system/test_scheduling_heap.cpp \
+	tests/system/test_trigger_scheduler.cpp \
 	tests/test_util.cpp \
 	tests/test_start_stop.cpp \
 	tests/test_hardware_reinit.cpp \
@@ -105,6 +116,9 @@ TESTS_SRC_CPP = \
 	tests/test_hpfp_integrated.cpp \
 	tests/test_fuel_math.cpp \
 	tests/test_binary_log.cpp \
+	tests/test_tooth_log_compact.cpp \
+	tests/test_flash_journal.cpp \
+	tests/test_config_change_tracker.cpp \
 	tests/test_dynoview.cpp \
 	tests/test_gpio.cpp \
 	tests/test_limp.cpp \
@@ -115,6 +129,7 @@ TESTS_SRC_CPP = \
 	tests/sensor/test_frequency_sensor.cpp \
 	tests/sensor/test_turbocharger_speed_converter.cpp \
 	tests/sensor/test_vehicle_speed_converter.cpp \
+	tests/sensor/test_software_knock.cpp \
 	tests/actuators/test_aux_valves.cpp \
 	tests/actuators/test_antilag.cpp \
 	tests/actuators/test_boost.cpp \
@@ -0,0 +1,145 @@
+/*
+ * @file test_angle_prediction.cpp
+ *
+ * Angle to time conversion under changing RPM: cached RPM versus InstantRpmCalculator::getAngleToTimeUs,
+ * both compared with the exact moment the crank gets there.
+ */
+
+#include "pch.h"
+#include "trigger_replay.h"
+
+// so that no tooth is at zero time, zero means 'no timestamp' for instant RPM
+#define RAMP_START_US 1'000'000
+
+static constexpr size_t horizonCount = 5;
+static const angle_t horizons[horizonCount] = { 30, 90, 180, 360, 540 };
+
+struct AngleToTimeError {
+	// crank degrees between where the event was expected and where the crank actually was at that moment
+	float cachedRpm = 0;
+	float predicted = 0;
+};
+
+static void sweepRamp(int startRpm, int endRpm, AngleToTimeError (&maxError)[horizonCount]) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	setCrankOperationMode();
+	eth.setTriggerType(trigger_type_e::TT_TOOTHED_WHEEL_60_2);
+
+	const int revolutions = 40;
+	RpmRamp ramp(startRpm, endRpm, revolutions * 360);
+	TriggerCapture capture;
+	capture.synthesize(getTriggerCentral()->triggerShape, ramp, revolutions);
+
+	double rampEnd = ramp.getTime(revolutions * 360);
+
+	for (const auto& edge : capture.edges) {
+		eth.setTimeAndInvokeEventsUs(RAMP_START_US + edge.timeUs);
+		hwHandleShaftSignal(edge.index, edge.value, getTimeNowNt());
+
+		float oneDegreeUs = engine->rpmCalculator.oneDegreeUs;
+		if (cisnan(oneDegreeUs) || Sensor::getOrZero(SensorType::Rpm) == 0) {
+			// nothing to compare yet
+			continue;
+		}
+
+		double now = edge.timeUs * 1e-6;
+		double angle = ramp.getAngle(now);
+
+		for (size_t i = 0; i < horizonCount; i++) {
+			double target = ramp.getTime(angle + horizons[i]);
+			if (target > rampEnd) {
+				continue;
+			}
+
+			double speedAtTarget = ramp.getSpeed(target);
+			double idealUs = (target - now) * 1e6;
+			float predictedUs = engine->triggerCentral.instantRpm.getAngleToTimeUs(horizons[i], getTimeNowNt());
+			float cachedUs = oneDegreeUs * horizons[i];
+
+			EXPECT_FALSE(cisnan(predictedUs));
+			maxError[i].predicted = std::max<float>(maxError[i].predicted, std::abs(predictedUs - idealUs) * 1e-6 * speedAtTarget);
+			maxError[i].cachedRpm = std::max<float>(maxError[i].cachedRpm, std::abs(cachedUs - idealUs) * 1e-6 * speedAtTarget);
+		}
+	}
+
+	for (size_t i = 0; i < horizonCount; i++) {
+		printf("Angle prediction %d->%d rpm, %.0f degrees ahead: cached RPM max error %.2f deg, predicted max error %.2f deg\n",
+			startRpm, endRpm, horizons[i], maxError[i].cachedRpm, maxError[i].predicted);
+	}
+}
+
+TEST(AnglePrediction, constantRpm) {
+	AngleToTimeError maxError[horizonCount];
+	sweepRamp(3000, 3000, maxError);
+
+	for (size_t i = 0; i < horizonCount; i++) {
+		EXPECT_LT(maxError[i].predicted, 0.5) << horizons[i];
+	}
+}
+
+TEST(AnglePrediction, acceleration) {
+	AngleToTimeError maxError[horizonCount];
+	// about 10000 rpm per second, free revving light flywheel engine
+	sweepRamp(1000, 7000, maxError);
+
+	for (size_t i = 0; i < horizonCount; i++) {
+		EXPECT_LT(maxError[i].predicted, maxError[i].cachedRpm / 4) << horizons[i];
+	}
+}
+
+TEST(AnglePrediction, deceleration) {
+	AngleToTimeError maxError[horizonCount];
+	sweepRamp(7000, 1000, maxError);
+
+	for (size_t i = 0; i < horizonCount; i++) {
+		EXPECT_LT(maxError[i].predicted, maxError[i].cachedRpm / 4) << horizons[i];
+	}
+}
+
+static void doNothing(void *) {
+}
+
+TEST(AnglePrediction, scheduleByAngle) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	setCrankOperationMode();
+	eth.setTriggerType(trigger_type_e::TT_TOOTHED_WHEEL_60_2);
+
+	const int revolutions = 40;
+	RpmRamp ramp(1000, 7000, revolutions * 360);
+	TriggerCapture capture;
+	capture.synthesize(getTriggerCentral()->triggerShape, ramp, revolutions);
+
+	// stop half way up the ramp, well away from both ends
+	size_t stopAt = capture.edges.size() / 2;
+	for (size_t i = 0; i < stopAt; i++) {
+		const auto& edge = capture.edges[i];
+		eth.setTimeAndInvokeEventsUs(RAMP_START_US + edge.timeUs);
+		hwHandleShaftSignal(edge.index, edge.value, getTimeNowNt());
+	}
+	ASSERT_GT(Sensor::getOrZero(SensorType::Rpm), 0);
+
+	efitick_t nowNt = getTimeNowNt();
+	double now = capture.edges[stopAt - 1].timeUs * 1e-6;
+	double idealUs = (ramp.getTime(ramp.getAngle(now) + 180) - now) * 1e6;
+
+	scheduling_s cachedTimer;
+	engine->rpmCalculator.predictiveAngleScheduling = false;
+	efitick_t cached = scheduleByAngle(&cachedTimer, nowNt, 180, doNothing);
+	EXPECT_EQ(cached, nowNt + USF2NT(engine->rpmCalculator.oneDegreeUs * 180));
+
+	scheduling_s predictedTimer;
+	engine->rpmCalculator.predictiveAngleScheduling = true;
+	efitick_t predicted = scheduleByAngle(&predictedTimer, nowNt, 180, doNothing);
+	EXPECT_EQ(predicted, nowNt + USF2NT(engine->triggerCentral.instantRpm.getAngleToTimeUs(180, nowNt)));
+
+	// accelerating: cached RPM is late, prediction lands closer to where the crank actually is
+	double cachedErrorUs = std::abs(NT2US((float)(cached - nowNt)) - idealUs);
+	double predictedErrorUs = std::abs(NT2US((float)(predicted - nowNt)) - idealUs);
+	EXPECT_LT(predictedErrorUs, cachedErrorUs / 4);
+
+	// tooth estimate too old to trust, same as with the switch off
+	scheduling_s staleTimer;
+	efitick_t staleNt = nowNt + MS2NT(2000);
+	EXPECT_EQ(scheduleByAngle(&staleTimer, staleNt, 180, doNothing),
+		staleNt + USF2NT(engine->rpmCalculator.oneDegreeUs * 180));
+}
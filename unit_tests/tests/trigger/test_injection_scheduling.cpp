@@ -21,8 +21,9 @@ TEST(injectionScheduling, InjectionIsScheduled) {
 
 	// Injection duration of 20ms
 	MockInjectorModel2 im;
-	EXPECT_CALL(im, getInjectionDuration(_)).WillOnce(Return(20.0f));
+	EXPECT_CALL(im, getInjectionDuration(_)).WillRepeatedly(Return(20.0f));
 	engine->module<InjectorModel>().set(&im);
+	engine->engineState.updateFuelPlan();
 
 	engine->rpmCalculator.oneDegreeUs = 100;
 
@@ -61,8 +62,9 @@ TEST(injectionScheduling, InjectionIsScheduledBeforeWraparound) {
 
 	// Injection duration of 20ms
 	MockInjectorModel2 im;
-	EXPECT_CALL(im, getInjectionDuration(_)).WillOnce(Return(20.0f));
+	EXPECT_CALL(im, getInjectionDuration(_)).WillRepeatedly(Return(20.0f));
 	engine->module<InjectorModel>().set(&im);
+	engine->engineState.updateFuelPlan();
 
 	engine->rpmCalculator.oneDegreeUs = 100;
 
@@ -100,8 +102,9 @@ TEST(injectionScheduling, InjectionIsScheduledAfterWraparound) {
 
 	// Injection duration of 20ms
 	MockInjectorModel2 im;
-	EXPECT_CALL(im, getInjectionDuration(_)).WillOnce(Return(20.0f));
+	EXPECT_CALL(im, getInjectionDuration(_)).WillRepeatedly(Return(20.0f));
 	engine->module<InjectorModel>().set(&im);
+	engine->engineState.updateFuelPlan();
 
 	engine->rpmCalculator.oneDegreeUs = 100;
 
@@ -156,4 +159,89 @@ TEST(injectionScheduling, InjectionNotScheduled) {
 
 	// We are at 130 degrees now, next tooth 140
 	event.onTriggerTooth(1000, nowNt, 130, 140);
-}
\ No newline at end of file
+}
+TEST(injectionScheduling, InjectionUsesFuelPlan) {
+	StrictMock<MockExecutor> mockExec;
+
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	engine->executor.setMockExecutor(&mockExec);
+
+	efitick_t nowNt = 1000000;
+
+	InjectionEvent event;
+	InjectorOutputPin pin;
+	pin.injectorIndex = 0;
+	event.outputs[0] = &pin;
+
+	// Linear injector has been resolved by fast callback, trigger callback should not run injector model
+	StrictMock<MockInjectorModel2> im;
+	engine->module<InjectorModel>().set(&im);
+	// mass is different from planned one, even no fuel was planned, duration still follows it
+	engine->engineState.injectionMass[0] = 0.012f;
+	engine->engineState.fuelPlan.cylinders[0].massGrams = 0;
+	engine->engineState.fuelPlan.cylinders[0].duration = 0;
+	engine->engineState.fuelPlan.isLinear = true;
+	engine->engineState.fuelPlan.msPerGram = 1000;
+	engine->engineState.fuelPlan.deadtime = 3;
+
+	engine->rpmCalculator.oneDegreeUs = 100;
+
+	{
+		InSequence is;
+
+		// rising edge 5 degrees from now
+		float nt5deg = USF2NT(engine->rpmCalculator.oneDegreeUs * 5);
+		efitick_t startTime = nowNt + nt5deg;
+		EXPECT_CALL(mockExec, scheduleByTimestampNt(testing::NotNull(), &event.signalTimerUp, startTime, _));
+		// falling edge 12ms + 3ms deadtime later
+		EXPECT_CALL(mockExec, scheduleByTimestampNt(testing::NotNull(), &event.endOfInjectionEvent, startTime + MS2NT(15), _));
+	}
+
+	// Event scheduled at 125 degrees
+	event.injectionStartAngle = 125;
+
+	// We are at 120 degrees now, next tooth 130
+	event.onTriggerTooth(1000, nowNt, 120, 130);
+}
+
+TEST(injectionScheduling, NonlinearInjectorUsesModelForUnplannedMass) {
+	StrictMock<MockExecutor> mockExec;
+
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	engine->executor.setMockExecutor(&mockExec);
+
+	efitick_t nowNt = 1000000;
+
+	InjectionEvent event;
+	InjectorOutputPin pin;
+	pin.injectorIndex = 0;
+	event.outputs[0] = &pin;
+
+	// Small pulse correction of planned mass does not apply to a different mass, injector model has to run
+	StrictMock<MockInjectorModel2> im;
+	EXPECT_CALL(im, getInjectionDuration(0.012f)).WillOnce(Return(15.0f));
+	engine->module<InjectorModel>().set(&im);
+	engine->engineState.injectionMass[0] = 0.012f;
+	engine->engineState.fuelPlan.cylinders[0].massGrams = 0.01f;
+	engine->engineState.fuelPlan.cylinders[0].duration = 11;
+	engine->engineState.fuelPlan.isLinear = false;
+
+	engine->rpmCalculator.oneDegreeUs = 100;
+
+	{
+		InSequence is;
+
+		// rising edge 5 degrees from now
+		float nt5deg = USF2NT(engine->rpmCalculator.oneDegreeUs * 5);
+		efitick_t startTime = nowNt + nt5deg;
+		EXPECT_CALL(mockExec, scheduleByTimestampNt(testing::NotNull(), &event.signalTimerUp, startTime, _));
+		// falling edge 15ms later
+		EXPECT_CALL(mockExec, scheduleByTimestampNt(testing::NotNull(), &event.endOfInjectionEvent, startTime + MS2NT(15), _));
+	}
+
+	// Event scheduled at 125 degrees
+	event.injectionStartAngle = 125;
+
+	// We are at 120 degrees now, next tooth 130
+	event.onTriggerTooth(1000, nowNt, 120, 130);
+}
@@ -553,6 +553,7 @@ void doTestFuelSchedulerBug299smallAndMedium(int startUpDelayMs) {
 	MockInjectorModel2 im;
 	EXPECT_CALL(im, getInjectionDuration(_)).WillRepeatedly(Return(12.5f));
 	engine->module<InjectorModel>().set(&im);
+	engine->engineState.updateFuelPlan();
 
 	assertEqualsM("duty for maf=3", 62.5, getInjectorDutyCycle(round(Sensor::getOrZero(SensorType::Rpm))));
 
@@ -713,6 +714,7 @@ void doTestFuelSchedulerBug299smallAndMedium(int startUpDelayMs) {
 	MockInjectorModel2 im2;
 	EXPECT_CALL(im2, getInjectionDuration(_)).WillRepeatedly(Return(17.5f));
 	engine->module<InjectorModel>().set(&im2);
+	engine->engineState.updateFuelPlan();
 
 	// duty cycle above 75% is a special use-case because 'special' fuel event overlappes the next normal event in batch mode
 	assertEqualsM("duty for maf=3", 87.5, getInjectorDutyCycle(round(Sensor::getOrZero(SensorType::Rpm))));
@@ -910,6 +912,7 @@ TEST(big, testFuelSchedulerBug299smallAndLarge) {
 	MockInjectorModel2 im;
 	EXPECT_CALL(im, getInjectionDuration(_)).WillRepeatedly(Return(17.5f));
 	engine->module<InjectorModel>().set(&im);
+	engine->engineState.updateFuelPlan();
 
 	assertEqualsM("Lduty for maf=3", 87.5, getInjectorDutyCycle(round(Sensor::getOrZero(SensorType::Rpm))));
 
@@ -977,6 +980,7 @@ TEST(big, testFuelSchedulerBug299smallAndLarge) {
 	MockInjectorModel2 im2;
 	EXPECT_CALL(im2, getInjectionDuration(_)).WillRepeatedly(Return(2.0f));
 	engine->module<InjectorModel>().set(&im2);
+	engine->engineState.updateFuelPlan();
 
 	ASSERT_EQ( 10,  getInjectorDutyCycle(round(Sensor::getOrZero(SensorType::Rpm)))) << "Lduty for maf=3";
 
@@ -0,0 +1,104 @@
+/*
+ * @file test_trigger_replay_benchmark.cpp
+ *
+ * Decoder hot path cost: recorded captures and ideal signal for each trigger type replayed through hwHandleShaftSignal.
+ * Default pass count keeps regular unit test runs quick,
+ * set RUSEFI_TRIGGER_REPLAY_PASSES to get millions of edges per trigger.
+ */
+
+#include "pch.h"
+#include "trigger_replay.h"
+
+static void benchmarkRecordedCapture(EngineTestHelper& eth, const char *name, const TriggerCapture& capture) {
+	ASSERT_FALSE(capture.edges.empty()) << name;
+
+	TriggerReplayResult result = replayTriggerCapture(eth, name, capture, getTriggerReplayPassCount(1));
+	EXPECT_TRUE(result.edgeCount > 0);
+}
+
+TEST(TriggerReplayBenchmark, mitsubishi4b11) {
+	TriggerCapture capture;
+	capture.loadCsv("tests/trigger/resources/4b11-running.csv", 1, /* vvtCount */ 0);
+
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	engineConfiguration->isFasterEngineSpinUpEnabled = true;
+	engineConfiguration->alwaysInstantRpm = true;
+	eth.setTriggerType(trigger_type_e::TT_36_2_1);
+
+	benchmarkRecordedCapture(eth, "replay 4b11-running", capture);
+}
+
+TEST(TriggerReplayBenchmark, gm24x) {
+	TriggerCapture capture;
+	capture.loadCsv("tests/trigger/resources/gm_24x_cranking.csv", 1, /* vvtCount */ 0);
+
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	engineConfiguration->isFasterEngineSpinUpEnabled = true;
+	engineConfiguration->alwaysInstantRpm = true;
+	eth.setTriggerType(trigger_type_e::TT_GM_24x);
+
+	benchmarkRecordedCapture(eth, "replay gm_24x_cranking", capture);
+}
+
+TEST(TriggerReplayBenchmark, volkswagen60_2) {
+	TriggerCapture capture;
+	capture.loadCsv("tests/trigger/resources/nick_1.csv", 1, /* vvtCount */ 0);
+
+	EngineTestHelper eth(engine_type_e::VW_ABA);
+	engineConfiguration->alwaysInstantRpm = true;
+	eth.setTriggerType(trigger_type_e::TT_60_2_VW);
+
+	benchmarkRecordedCapture(eth, "replay nick_1", capture);
+}
+
+TEST(TriggerReplayBenchmark, nissanCas24Plus1) {
+	TriggerCapture capture;
+	capture.loadCsv("tests/trigger/resources/cas_nissan_24_plus_1.csv", 1, /* vvtCount */ 1);
+
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	engineConfiguration->isFasterEngineSpinUpEnabled = true;
+	engineConfiguration->alwaysInstantRpm = true;
+	engineConfiguration->vvtMode[0] = VVT_SINGLE_TOOTH;
+	eth.setTriggerType(trigger_type_e::TT_12_TOOTH_CRANK);
+
+	benchmarkRecordedCapture(eth, "replay cas_nissan_24_plus_1", capture);
+}
+
+TEST(TriggerReplayBenchmark, hondaK20) {
+	TriggerCapture capture;
+	capture.loadCsv("tests/trigger/resources/civic-K20-cranking.csv", 1, /* vvtCount */ 2,
+		REVERSE_ORDER, /* twoBanksSingleCamMode */ false);
+
+	EngineTestHelper eth(engine_type_e::PROTEUS_HONDA_K);
+
+	benchmarkRecordedCapture(eth, "replay civic-K20-cranking", capture);
+}
+
+class TriggerReplayBenchmarkFixture : public ::testing::TestWithParam<int> {
+};
+
+INSTANTIATE_TEST_SUITE_P(
+	Triggers,
+	TriggerReplayBenchmarkFixture,
+	// same range as AllTriggersFixture
+	::testing::Range(1, (int)trigger_type_e::TT_UNUSED)
+);
+
+TEST_P(TriggerReplayBenchmarkFixture, idealSignal) {
+	trigger_type_e tt = (trigger_type_e)GetParam();
+
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	engineConfiguration->trigger.type = tt;
+	eth.applyTriggerWaveform();
+
+	TriggerWaveform& shape = getTriggerCentral()->triggerShape;
+	ASSERT_FALSE(shape.shapeDefinitionError);
+
+	TriggerCapture capture;
+	capture.synthesize(shape, /* rpm */ 3000, /* cycleCount */ 20);
+
+	char name[128];
+	snprintf(name, sizeof(name), "replay ideal %s", getTrigger_type_e(tt));
+	TriggerReplayResult result = replayTriggerCapture(eth, name, capture, getTriggerReplayPassCount(1));
+	EXPECT_TRUE(result.edgeCount >= capture.edges.size());
+}
@@ -0,0 +1,165 @@
+/*
+ * @file test_map3d_lookup.cpp
+ *
+ * Table lookups with axis bins shared through Map3DLookupContext
+ */
+
+#include "pch.h"
+
+#include "fuel_math.h"
+#include "advance_map.h"
+
+#include "benchmark_helper.h"
+
+static constexpr int cols = 16;
+static constexpr int rows = 16;
+
+struct TestTables {
+	// same layout as VE/lambda/ignition: scaled values and load axis, plain RPM axis
+	scaled_channel<uint16_t, 10> ve[rows][cols];
+	scaled_channel<uint8_t, 147, 1> lambda[rows][cols];
+	float advance[rows][cols];
+	scaled_channel<uint16_t, 100> loadBins[rows];
+	uint16_t rpmBins[cols];
+	// axis with the same values but different array
+	scaled_channel<uint16_t, 100> otherLoadBins[rows];
+
+	TestTables() {
+		setRpmTableBin(rpmBins);
+		setLinearCurve(loadBins, 10, 250, 1);
+		setLinearCurve(otherLoadBins, 10, 250, 1);
+
+		for (int r = 0; r < rows; r++) {
+			for (int c = 0; c < cols; c++) {
+				ve[r][c] = 40 + r * 3.1f + c * 1.3f;
+				lambda[r][c] = 1.0f - r * 0.01f;
+				advance[r][c] = 35 - r * 1.5f + c * 0.7f;
+			}
+		}
+	}
+};
+
+TEST(Map3DLookup, findAxisBin) {
+	float bins[] = { 10, 20, 40 };
+
+	AxisBin below = findAxisBin(bins, 5);
+	EXPECT_EQ(0u, below.idx);
+	EXPECT_EQ(0, below.frac);
+
+	AxisBin first = findAxisBin(bins, 15);
+	EXPECT_EQ(0u, first.idx);
+	EXPECT_NEAR(0.5, first.frac, EPS4D);
+
+	AxisBin exact = findAxisBin(bins, 20);
+	EXPECT_EQ(1u, exact.idx);
+	EXPECT_EQ(0, exact.frac);
+
+	AxisBin second = findAxisBin(bins, 30);
+	EXPECT_EQ(1u, second.idx);
+	EXPECT_NEAR(0.5, second.frac, EPS4D);
+
+	AxisBin above = findAxisBin(bins, 50);
+	EXPECT_EQ(1u, above.idx);
+	EXPECT_EQ(1, above.frac);
+
+	AxisBin nan = findAxisBin(bins, NAN);
+	EXPECT_EQ(0u, nan.idx);
+	EXPECT_EQ(0, nan.frac);
+}
+
+TEST(Map3DLookup, findAxisBinMatchesLinearScan) {
+	uint16_t bins[cols];
+	setRpmTableBin(bins);
+
+	for (float value = 0; value < 8000; value += 13.7f) {
+		AxisBin result = findAxisBin(bins, value);
+
+		size_t expected = 0;
+		while (expected < cols - 2 && bins[expected + 1] <= value) {
+			expected++;
+		}
+		EXPECT_EQ(expected, result.idx) << value;
+	}
+}
+
+TEST(Map3DLookup, matchesInterpolate3d) {
+	TestTables t;
+
+	// includes off-scale on both ends of both axes
+	for (float rpm = 0; rpm < 8000; rpm += 137) {
+		for (float load = 0; load < 300; load += 7.3f) {
+			Map3DLookupContext context(rpm, load);
+
+			EXPECT_NEAR(interpolate3d(t.ve, t.loadBins, load, t.rpmBins, rpm), interpolate3d(context, t.ve, t.loadBins, t.rpmBins), EPS3D) << rpm << "/" << load;
+			EXPECT_NEAR(interpolate3d(t.lambda, t.loadBins, load, t.rpmBins, rpm), interpolate3d(context, t.lambda, t.loadBins, t.rpmBins), EPS4D) << rpm << "/" << load;
+			EXPECT_NEAR(interpolate3d(t.advance, t.loadBins, load, t.rpmBins, rpm), interpolate3d(context, t.advance, t.loadBins, t.rpmBins), EPS3D) << rpm << "/" << load;
+			EXPECT_NEAR(interpolate3d(t.advance, t.otherLoadBins, load, t.rpmBins, rpm), interpolate3d(context, t.advance, t.otherLoadBins, t.rpmBins), EPS3D) << rpm << "/" << load;
+		}
+	}
+}
+
+TEST(Map3DLookup, sharedAxis) {
+	TestTables t;
+	Map3DLookupContext context(3100, 87);
+
+	interpolate3d(context, t.ve, t.loadBins, t.rpmBins);
+	EXPECT_EQ(0, context.hitCount);
+
+	// same rpm and load arrays
+	interpolate3d(context, t.lambda, t.loadBins, t.rpmBins);
+	interpolate3d(context, t.advance, t.loadBins, t.rpmBins);
+	EXPECT_EQ(4, context.hitCount);
+
+	// equal values are not enough, only the RPM axis is shared
+	interpolate3d(context, t.advance, t.otherLoadBins, t.rpmBins);
+	EXPECT_EQ(5, context.hitCount);
+}
+
+TEST(Map3DLookup, cylinderTrims) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	setRpmTableBin(config->fuelTrimRpmBins);
+	setLinearCurve(config->fuelTrimLoadBins, 20, 120, 1);
+	for (size_t i = 0; i < efi::size(config->fuelTrims); i++) {
+		config->fuelTrims[i].table[1][2] = i;
+	}
+
+	Map3DLookupContext trimLookup(4000, 50);
+	for (size_t i = 0; i < efi::size(config->fuelTrims); i++) {
+		float expected = (100 + interpolate3d(config->fuelTrims[i].table,
+			config->fuelTrimLoadBins, 50,
+			config->fuelTrimRpmBins, 4000)) / 100;
+		EXPECT_NEAR(expected, getCylinderFuelTrim(i, trimLookup), EPS4D) << i;
+	}
+
+	// both axes searched once for the first cylinder only
+	EXPECT_EQ(2 * ((int)efi::size(config->fuelTrims) - 1), trimLookup.hitCount);
+}
+
+TEST(Map3DLookup, benchmarkCylinderTrims) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	float sum = 0;
+
+	// fuel and ignition trims for twelve cylinders, same as each fast callback does
+	runBenchmark("cylinder trims, independent lookups", 100000, [&](int i) {
+		float rpm = 800 + (i % 64) * 100;
+		float load = 20 + (i % 37) * 5;
+		for (size_t cyl = 0; cyl < 12; cyl++) {
+			sum += interpolate3d(config->fuelTrims[cyl].table, config->fuelTrimLoadBins, load, config->fuelTrimRpmBins, rpm);
+			sum += interpolate3d(config->ignTrims[cyl].table, config->ignTrimLoadBins, load, config->ignTrimRpmBins, rpm);
+		}
+	});
+
+	runBenchmark("cylinder trims, shared context", 100000, [&](int i) {
+		float rpm = 800 + (i % 64) * 100;
+		float load = 20 + (i % 37) * 5;
+		Map3DLookupContext fuelTrimLookup(rpm, load);
+		Map3DLookupContext ignitionTrimLookup(rpm, load);
+		for (size_t cyl = 0; cyl < 12; cyl++) {
+			sum += getCylinderFuelTrim(cyl, fuelTrimLookup);
+			sum += getCombinedCylinderIgnitionTrim(cyl, ignitionTrimLookup);
+		}
+	});
+
+	// keep the compiler from optimizing lookups away
+	EXPECT_FALSE(cisnan(sum));
+}
@@ -0,0 +1,119 @@
+#include "pch.h"
+
+#include "record_ring_writer.h"
+
+static const char* testBuffer = "abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+
+static void writeRecord(RecordRingWriter<8, 4>& dut, const char* data, size_t count) {
+	dut.beginRecord();
+	dut.write(data, count);
+}
+
+TEST(RecordRingWriter, OnlyFullBlocks) {
+	RecordRingWriter<8, 4> dut;
+	size_t size;
+
+	writeRecord(dut, testBuffer, 5);
+	ASSERT_TRUE(dut.commitRecord());
+	EXPECT_EQ(nullptr, dut.getFullBlocks(size));
+	EXPECT_EQ(0u, size);
+
+	writeRecord(dut, testBuffer + 5, 12);
+	ASSERT_TRUE(dut.commitRecord());
+
+	const char* blocks = dut.getFullBlocks(size);
+	ASSERT_NE(nullptr, blocks);
+	EXPECT_EQ(16u, size);
+	EXPECT_EQ(0, memcmp(blocks, testBuffer, 16));
+
+	dut.releaseBlocks(size);
+	EXPECT_EQ(1u, dut.getUsed());
+	EXPECT_EQ(nullptr, dut.getFullBlocks(size));
+}
+
+TEST(RecordRingWriter, PartialBlock) {
+	RecordRingWriter<8, 4> dut;
+	size_t size;
+
+	EXPECT_EQ(nullptr, dut.getPartialBlock(size));
+
+	writeRecord(dut, testBuffer, 5);
+	ASSERT_TRUE(dut.commitRecord());
+	const char* partial = dut.getPartialBlock(size);
+	ASSERT_NE(nullptr, partial);
+	EXPECT_EQ(5u, size);
+	EXPECT_EQ(0, memcmp(partial, testBuffer, 5));
+
+	// full blocks go first
+	writeRecord(dut, testBuffer + 5, 6);
+	ASSERT_TRUE(dut.commitRecord());
+	EXPECT_EQ(nullptr, dut.getPartialBlock(size));
+
+	dut.getFullBlocks(size);
+	dut.releaseBlocks(size);
+	partial = dut.getPartialBlock(size);
+	EXPECT_EQ(3u, size);
+	EXPECT_EQ(0, memcmp(partial, testBuffer + 8, 3));
+	// peeking does not consume
+	EXPECT_EQ(3u, dut.getUsed());
+}
+
+TEST(RecordRingWriter, UncommittedNotVisible) {
+	RecordRingWriter<8, 4> dut;
+	size_t size;
+
+	writeRecord(dut, testBuffer, 10);
+	EXPECT_EQ(nullptr, dut.getFullBlocks(size));
+
+	ASSERT_TRUE(dut.commitRecord());
+	EXPECT_NE(nullptr, dut.getFullBlocks(size));
+	EXPECT_EQ(8u, size);
+}
+
+TEST(RecordRingWriter, DropWholeRecord) {
+	RecordRingWriter<8, 4> dut;
+	size_t size;
+
+	writeRecord(dut, testBuffer, 20);
+	ASSERT_TRUE(dut.commitRecord());
+
+	// two writes, the second one does not fit: nothing of this record is kept
+	dut.beginRecord();
+	dut.write(testBuffer + 20, 6);
+	dut.write(testBuffer + 26, 10);
+	EXPECT_FALSE(dut.commitRecord());
+	EXPECT_EQ(1u, dut.getDroppedRecords());
+	EXPECT_EQ(20u, dut.getUsed());
+
+	// a record which fits still goes in after the dropped one
+	writeRecord(dut, testBuffer + 20, 12);
+	ASSERT_TRUE(dut.commitRecord());
+	EXPECT_EQ(32u, dut.getUsed());
+
+	const char* blocks = dut.getFullBlocks(size);
+	EXPECT_EQ(32u, size);
+	EXPECT_EQ(0, memcmp(blocks, testBuffer, 32));
+}
+
+TEST(RecordRingWriter, WrapAround) {
+	RecordRingWriter<8, 4> dut;
+	size_t size;
+
+	writeRecord(dut, testBuffer, 28);
+	ASSERT_TRUE(dut.commitRecord());
+	dut.releaseBlocks(24);
+
+	// record crosses the end of the buffer
+	writeRecord(dut, testBuffer + 28, 12);
+	ASSERT_TRUE(dut.commitRecord());
+
+	// contiguous run stops at the end of the buffer
+	const char* blocks = dut.getFullBlocks(size);
+	EXPECT_EQ(8u, size);
+	EXPECT_EQ(0, memcmp(blocks, testBuffer + 24, 8));
+	dut.releaseBlocks(size);
+
+	blocks = dut.getFullBlocks(size);
+	EXPECT_EQ(8u, size);
+	EXPECT_EQ(0, memcmp(blocks, testBuffer + 32, 8));
+}